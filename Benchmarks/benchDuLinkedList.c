@@ -0,0 +1,258 @@
+/**
+ * @file benchDuLinkedList.c
+ * @brief Doubly linked list part of the benchmark suite, NULL-terminated and circular
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "duLinkedList.h"
+#include "duCircularList.h"
+#include "benchSuite.h"
+
+#define STRUCTURE "duLinkedList"
+#define CIRCULAR "duCircularList"
+#define BATCH_SIZE 256          /**< Buffer of TraverseListBatch_DuL */
+
+static long long visitSum = 0;
+
+static void visitElement(ElemType e) {
+    visitSum += e;
+}
+
+static void visitBlock(const ElemType *block, int n) {
+    for (int i = 0; i < n; i++) {
+        visitSum += block[i];
+    }
+}
+
+/**
+ * @brief Build a list of size nodes by inserting after the tail
+ */
+static Status buildList(DuLinkedList *L, long size) {
+    DuLNode *tail;
+
+    if (InitList_DuL(L) == ERROR) {
+        return ERROR;
+    }
+    tail = *L;
+    for (long i = 0; i < size; i++) {
+        DuLNode *node = (DuLNode *)malloc(sizeof(DuLNode));
+        if (node == NULL) {
+            DestroyList_DuL(L);
+            return ERROR;
+        }
+        node->data = (ElemType)i;
+        node->prior = NULL;
+        node->next = NULL;
+        InsertAfterList_DuL(tail, node);
+        tail = node;
+    }
+    return SUCCESS;
+}
+
+static int byAddress(const void *a, const void *b) {
+    const DuLNode *x = *(DuLNode *const *)a, *y = *(DuLNode *const *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * @brief Relink the nodes in a random order, or back in address order
+ * @note The nodes are freed in list order, so a list left shuffled would scatter the nodes
+ *       malloc hands to the structures measured after it.
+ */
+static Status relinkList(DuLinkedList L, long size, int shuffled) {
+    DuLNode **nodes = (DuLNode **)malloc((size_t)size * sizeof(DuLNode *));
+    DuLNode *current = L->next;
+    unsigned long long seed = 0x9E3779B97F4A7C15ull;
+
+    if (nodes == NULL) {
+        return ERROR;
+    }
+    for (long i = 0; i < size; i++) {
+        nodes[i] = current;
+        current = current->next;
+    }
+    if (shuffled) {
+        for (long i = size - 1; i > 0; i--) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            long j = (long)(seed % (unsigned long long)(i + 1));
+            DuLNode *temp = nodes[i];
+            nodes[i] = nodes[j];
+            nodes[j] = temp;
+        }
+    } else {
+        qsort(nodes, (size_t)size, sizeof(DuLNode *), byAddress);
+    }
+
+    current = L;
+    for (long i = 0; i < size; i++) {
+        current->next = nodes[i];
+        nodes[i]->prior = current;
+        current = nodes[i];
+    }
+    current->next = NULL;
+    free(nodes);
+    return SUCCESS;
+}
+
+/**
+ * @brief Time TraverseList_DuL and TraverseListBatch_DuL on an existing list
+ */
+static void measureTraversals(DuLinkedList L, long size, const char *traverseName,
+                              const char *batchName) {
+    int reps = benchRepetitions(size);
+    ElemType buffer[BATCH_SIZE];
+    double best = 1e30, total = 0, t;
+
+    for (int r = 0; r < reps; r++) {
+        t = benchNow();
+        TraverseList_DuL(L, visitElement);
+        t = benchNow() - t;
+        best = t < best ? t : best;
+        total += t;
+    }
+    benchRecord(STRUCTURE, traverseName, size, reps, best, total);
+
+    best = 1e30;
+    total = 0;
+    for (int r = 0; r < reps; r++) {
+        t = benchNow();
+        TraverseListBatch_DuL(L, buffer, BATCH_SIZE, visitBlock);
+        t = benchNow() - t;
+        best = t < best ? t : best;
+        total += t;
+    }
+    benchRecord(STRUCTURE, batchName, size, reps, best, total);
+    benchSink += visitSum;
+}
+
+/**
+ * @brief Append one node to a NULL-terminated list, which has to find the tail first
+ */
+static void appendByWalk(DuLinkedList L, DuLNode *node) {
+    DuLNode *tail = L;
+
+    while (tail->next != NULL) {
+        tail = tail->next;
+    }
+    InsertAfterList_DuL(tail, node);
+}
+
+/**
+ * @brief Queue use of the circular list, and joining and cutting lists of this size
+ */
+static void benchCircular(long size) {
+    int reps = benchRepetitions(size);
+    double pushBest = 1e30, pushTotal = 0, popBest = 1e30, popTotal = 0;
+    double concatBest = 1e30, concatTotal = 0, splitBest = 1e30, splitTotal = 0;
+    CircularList_DuL L, other;
+    ElemType e;
+    double t;
+
+    if (InitList_CDuL(&L) == ERROR || InitList_CDuL(&other) == ERROR) {
+        fprintf(stderr, "%s %ld: out of memory\n", CIRCULAR, size);
+        return;
+    }
+    for (int r = 0; r < reps; r++) {
+        t = benchNow();
+        for (long i = 0; i < size; i++) {
+            if (PushBack_CDuL(L, (ElemType)i) == ERROR) {
+                fprintf(stderr, "%s %ld: out of memory\n", CIRCULAR, size);
+                DestroyList_CDuL(&L);
+                DestroyList_CDuL(&other);
+                return;
+            }
+        }
+        t = benchNow() - t;
+        pushBest = t < pushBest ? t : pushBest;
+        pushTotal += t;
+
+        // Cut at the middle and join again, neither depends on the length
+        DuLNode *mid = L;
+        for (long i = 0; i <= size / 2; i++) {
+            mid = mid->next;
+        }
+        t = benchNow();
+        Split_CDuL(L, mid, other);
+        t = benchNow() - t;
+        splitBest = t < splitBest ? t : splitBest;
+        splitTotal += t;
+        t = benchNow();
+        Concat_CDuL(L, other);
+        t = benchNow() - t;
+        concatBest = t < concatBest ? t : concatBest;
+        concatTotal += t;
+
+        t = benchNow();
+        while (PopFront_CDuL(L, &e) == SUCCESS) {
+            benchSink += e;
+        }
+        t = benchNow() - t;
+        popBest = t < popBest ? t : popBest;
+        popTotal += t;
+    }
+    benchRecord(CIRCULAR, "pushBack", size, reps, pushBest, pushTotal);
+    benchRecord(CIRCULAR, "popFront", size, reps, popBest, popTotal);
+    benchRecord(CIRCULAR, "split", size, reps, splitBest, splitTotal);
+    benchRecord(CIRCULAR, "concat", size, reps, concatBest, concatTotal);
+    DestroyList_CDuL(&L);
+    DestroyList_CDuL(&other);
+}
+
+void benchDuLinkedList(long size) {
+    int reps = benchRepetitions(size);
+    double buildBest = 1e30, buildTotal = 0, destroyBest = 1e30, destroyTotal = 0;
+    double t;
+    DuLinkedList L;
+
+    for (int r = 0; r < reps; r++) {
+        t = benchNow();
+        if (buildList(&L, size) == ERROR) {
+            fprintf(stderr, "%s %ld: out of memory\n", STRUCTURE, size);
+            return;
+        }
+        t = benchNow() - t;
+        buildBest = t < buildBest ? t : buildBest;
+        buildTotal += t;
+
+        // The last list is kept for the traversals
+        if (r == reps - 1) {
+            break;
+        }
+        t = benchNow();
+        DestroyList_DuL(&L);
+        t = benchNow() - t;
+        destroyBest = t < destroyBest ? t : destroyBest;
+        destroyTotal += t;
+    }
+    benchRecord(STRUCTURE, "build", size, reps, buildBest, buildTotal);
+
+    measureTraversals(L, size, "traverse", "traverseBatch");
+
+    // The same walks once consecutive nodes no longer sit next to each other in memory
+    if (relinkList(L, size, 1) == SUCCESS) {
+        measureTraversals(L, size, "traverseShuffled", "traverseBatchShuffled");
+        relinkList(L, size, 0);
+    }
+
+    // One append, the cost the circular list's PushBack and Concat avoid
+    DuLNode *node = (DuLNode *)malloc(sizeof(DuLNode));
+    if (node != NULL) {
+        node->data = 0;
+        t = benchNow();
+        appendByWalk(L, node);
+        t = benchNow() - t;
+        benchRecord(STRUCTURE, "appendByWalk", size, 1, t, t);
+    }
+
+    t = benchNow();
+    DestroyList_DuL(&L);
+    t = benchNow() - t;
+    destroyBest = t < destroyBest ? t : destroyBest;
+    destroyTotal += t;
+    benchRecord(STRUCTURE, "destroy", size, reps, destroyBest, destroyTotal);
+
+    benchCircular(size);
+}
@@ -0,0 +1,240 @@
+/**
+ * @file benchLinkedList.c
+ * @brief Singly linked list part of the benchmark suite
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "linkedList.h"
+#include "benchSuite.h"
+
+#define STRUCTURE "linkedList"
+#define BATCH_SIZE 256          /**< Buffer of TraverseListBatch */
+#define RECURSION_FRAME 64      /**< Stack bytes reserved per ReverseList_Recursive call */
+#define RECURSION_SLACK (1 << 20)
+
+typedef void (*ListOperation)(LinkedList *L);
+
+/**
+ * @brief Recursive reversal measured on its own thread
+ */
+typedef struct {
+    LinkedList L;
+    int repetitions;
+    double best;
+    double total;
+} RecursiveRun;
+
+static long long visitSum = 0;
+
+static void visitElement(ElemType e) {
+    visitSum += e;
+}
+
+static void visitBlock(const ElemType *block, int n) {
+    for (int i = 0; i < n; i++) {
+        visitSum += block[i];
+    }
+}
+
+/**
+ * @brief Build a list of size nodes by tail insertion, as Week1/main.c does
+ */
+static Status buildList(LinkedList *L, long size) {
+    LNode *tail;
+
+    if (InitList(L) == ERROR) {
+        return ERROR;
+    }
+    tail = *L;
+    for (long i = 0; i < size; i++) {
+        LNode *node = (LNode *)malloc(sizeof(LNode));
+        if (node == NULL) {
+            DestroyList(L);
+            return ERROR;
+        }
+        node->data = (ElemType)i;
+        node->next = NULL;
+        InsertList(tail, node);
+        tail = node;
+    }
+    return SUCCESS;
+}
+
+static int byAddress(const void *a, const void *b) {
+    const LNode *x = *(LNode *const *)a, *y = *(LNode *const *)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * @brief Relink the nodes in a random order, or back in address order
+ * @note The nodes are freed in list order, so a list left shuffled would scatter the nodes
+ *       malloc hands to the structures measured after it.
+ */
+static Status relinkList(LinkedList L, long size, int shuffled) {
+    LNode **nodes = (LNode **)malloc((size_t)size * sizeof(LNode *));
+    LNode *current = L->next;
+    unsigned long long seed = 0x9E3779B97F4A7C15ull;
+
+    if (nodes == NULL) {
+        return ERROR;
+    }
+    for (long i = 0; i < size; i++) {
+        nodes[i] = current;
+        current = current->next;
+    }
+    if (shuffled) {
+        for (long i = size - 1; i > 0; i--) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            long j = (long)(seed % (unsigned long long)(i + 1));
+            LNode *temp = nodes[i];
+            nodes[i] = nodes[j];
+            nodes[j] = temp;
+        }
+    } else {
+        qsort(nodes, (size_t)size, sizeof(LNode *), byAddress);
+    }
+
+    current = L;
+    for (long i = 0; i < size; i++) {
+        current->next = nodes[i];
+        current = nodes[i];
+    }
+    current->next = NULL;
+    free(nodes);
+    return SUCCESS;
+}
+
+static void traverse(LinkedList *L) {
+    TraverseList(*L, visitElement);
+}
+
+static void traverseBatch(LinkedList *L) {
+    ElemType buffer[BATCH_SIZE];
+    TraverseListBatch(*L, buffer, BATCH_SIZE, visitBlock);
+}
+
+static void search(LinkedList *L) {
+    benchSink += SearchList(*L, -1);  // Absent, so every node is compared
+}
+
+static void reverse(LinkedList *L) {
+    ReverseList(L);
+}
+
+static void findMid(LinkedList *L) {
+    benchSink += FindMidNode(L)->data;
+}
+
+static void isLoop(LinkedList *L) {
+    benchSink += IsLoopList(*L);
+}
+
+/**
+ * @brief Time repetitions of one operation on an existing list
+ */
+static void measure(const char *operation, LinkedList *L, long size, ListOperation op) {
+    int reps = benchRepetitions(size);
+    double best = 1e30, total = 0;
+
+    for (int r = 0; r < reps; r++) {
+        double t = benchNow();
+        op(L);
+        t = benchNow() - t;
+        best = t < best ? t : best;
+        total += t;
+    }
+    benchSink += visitSum;
+    benchRecord(STRUCTURE, operation, size, reps, best, total);
+}
+
+static void *recursiveReverse(void *arg) {
+    RecursiveRun *run = (RecursiveRun *)arg;
+
+    run->best = 1e30;
+    run->total = 0;
+    for (int r = 0; r < run->repetitions; r++) {
+        double t = benchNow();
+        run->L->next = ReverseList_Recursive(run->L->next);
+        t = benchNow() - t;
+        run->best = t < run->best ? t : run->best;
+        run->total += t;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Time ReverseList_Recursive on a thread with a stack deep enough for the list
+ */
+static void measureRecursive(LinkedList L, long size) {
+    RecursiveRun run = {L, benchRepetitions(size), 0, 0};
+    pthread_attr_t attr;
+    pthread_t tid;
+
+    pthread_attr_init(&attr);
+    if (pthread_attr_setstacksize(&attr, (size_t)size * RECURSION_FRAME + RECURSION_SLACK) != 0 ||
+        pthread_create(&tid, &attr, recursiveReverse, &run) != 0) {
+        fprintf(stderr, "%s reverseRecursive %ld: no thread with a deep enough stack\n",
+                STRUCTURE, size);
+        pthread_attr_destroy(&attr);
+        return;
+    }
+    pthread_join(tid, NULL);
+    pthread_attr_destroy(&attr);
+    benchRecord(STRUCTURE, "reverseRecursive", size, run.repetitions, run.best, run.total);
+}
+
+void benchLinkedList(long size, long maxRecursive) {
+    int reps = benchRepetitions(size);
+    double buildBest = 1e30, buildTotal = 0, destroyBest = 1e30, destroyTotal = 0;
+    LinkedList L;
+
+    for (int r = 0; r < reps; r++) {
+        double t = benchNow();
+        if (buildList(&L, size) == ERROR) {
+            fprintf(stderr, "%s %ld: out of memory\n", STRUCTURE, size);
+            return;
+        }
+        t = benchNow() - t;
+        buildBest = t < buildBest ? t : buildBest;
+        buildTotal += t;
+
+        // The last list is kept for the read-only operations
+        if (r == reps - 1) {
+            break;
+        }
+        t = benchNow();
+        DestroyList(&L);
+        t = benchNow() - t;
+        destroyBest = t < destroyBest ? t : destroyBest;
+        destroyTotal += t;
+    }
+    benchRecord(STRUCTURE, "build", size, reps, buildBest, buildTotal);
+
+    measure("traverse", &L, size, traverse);
+    measure("traverseBatch", &L, size, traverseBatch);
+    measure("search", &L, size, search);
+    measure("findMidNode", &L, size, findMid);
+    measure("isLoopList", &L, size, isLoop);
+    measure("reverse", &L, size, reverse);
+    if (size <= maxRecursive) {
+        measureRecursive(L, size);
+    }
+
+    // The same walks once consecutive nodes no longer sit next to each other in memory
+    if (relinkList(L, size, 1) == SUCCESS) {
+        measure("traverseShuffled", &L, size, traverse);
+        measure("traverseBatchShuffled", &L, size, traverseBatch);
+        relinkList(L, size, 0);
+    }
+
+    double t = benchNow();
+    DestroyList(&L);
+    t = benchNow() - t;
+    destroyBest = t < destroyBest ? t : destroyBest;
+    destroyTotal += t;
+    benchRecord(STRUCTURE, "destroy", size, reps, destroyBest, destroyTotal);
+}
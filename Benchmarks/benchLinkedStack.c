@@ -0,0 +1,49 @@
+/**
+ * @file benchLinkedStack.c
+ * @brief LinkedStack part of the benchmark suite: push and pop throughput
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include "linkedStack.h"
+#include "benchSuite.h"
+
+#define STRUCTURE "linkedStack"
+
+void benchLinkedStack(long size) {
+    int reps = benchRepetitions(size);
+    double pushBest = 1e30, pushTotal = 0, popBest = 1e30, popTotal = 0;
+    LinkedStack stack;
+    StackElement top;
+
+    stackInit(&stack);
+    for (int r = 0; r < reps; r++) {
+        double t = benchNow();
+        for (long i = 0; i < size; i++) {
+            if (!stackPush(&stack, (StackElement)i)) {
+                fprintf(stderr, "%s %ld: out of memory\n", STRUCTURE, size);
+                stackDestroy(&stack);
+                stackShrink(&stack);
+                return;
+            }
+        }
+        t = benchNow() - t;
+        pushBest = t < pushBest ? t : pushBest;
+        pushTotal += t;
+
+        t = benchNow();
+        while (stackTop(&stack, &top)) {
+            benchSink += top;
+            stackPop(&stack);
+        }
+        t = benchNow() - t;
+        popBest = t < popBest ? t : popBest;
+        popTotal += t;
+    }
+    benchRecord(STRUCTURE, "push", size, reps, pushBest, pushTotal);
+    benchRecord(STRUCTURE, "pop", size, reps, popBest, popTotal);
+
+    // Hand the cached nodes back before the next, larger size
+    stackDestroy(&stack);
+    stackShrink(&stack);
+}
@@ -0,0 +1,88 @@
+/**
+ * @file benchSuite.c
+ * @brief Benchmark suite for the list and stack modules, results as JSON on stdout
+ * @note Usage: benchSuite [maxSize] [maxRecursiveSize]
+ *       Sizes run from 1e3 to maxSize (default 1e8) in powers of ten. ReverseList_Recursive
+ *       recurses once per node, so it only runs up to maxRecursiveSize (default 1e7), on a
+ *       thread whose stack is sized for the list. Every result carries the best and the
+ *       mean time of its repetitions and the best time per element; progress goes to stderr.
+ *       Built with CONTAINER_STATS, the counters of the whole run are appended as well.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "containerStats.h"
+#include "benchSuite.h"
+
+#define DEFAULT_MAX_SIZE 100000000L
+#define DEFAULT_MAX_RECURSIVE 10000000L
+#define MIN_SIZE 1000L
+
+volatile long long benchSink = 0;
+
+static int recordCount = 0;
+
+double benchNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int benchRepetitions(long size) {
+    long reps = BENCH_WORK / size;
+    if (reps < 1) {
+        reps = 1;
+    }
+    if (reps > BENCH_MAX_REPS) {
+        reps = BENCH_MAX_REPS;
+    }
+    return (int)reps;
+}
+
+void benchRecord(const char* structure, const char* operation, long size, int repetitions,
+                 double best, double total) {
+    printf("%s\n    {\"structure\": \"%s\", \"operation\": \"%s\", \"size\": %ld, "
+           "\"repetitions\": %d, \"bestSeconds\": %.9f, \"meanSeconds\": %.9f, "
+           "\"nsPerElement\": %.3f}",
+           recordCount == 0 ? "" : ",", structure, operation, size, repetitions,
+           best, total / repetitions, best / size * 1e9);
+    recordCount++;
+    fflush(stdout);
+    fprintf(stderr, "%-12s %-18s %10ld  %8.3f ns/element\n", structure, operation, size,
+            best / size * 1e9);
+}
+
+int main(int argc, char* argv[]) {
+    long maxSize = argc > 1 ? (long)atof(argv[1]) : DEFAULT_MAX_SIZE;
+    long maxRecursive = argc > 2 ? (long)atof(argv[2]) : DEFAULT_MAX_RECURSIVE;
+
+    printf("{\n  \"suite\": \"dataStructures\",\n");
+#if defined(__VERSION__)
+    printf("  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    printf("  \"results\": [");
+    for (long size = MIN_SIZE; size <= maxSize; size *= 10) {
+        benchLinkedList(size, maxRecursive);
+        benchDuLinkedList(size);
+        benchLinkedStack(size);
+    }
+    printf("\n  ]");
+
+    if (containerStatsEnabled()) {
+        ContainerStats stats[STATS_CONTAINER_COUNT];
+        containerStatsSnapshot(stats);
+        printf(",\n  \"containerStats\": {");
+        for (int k = 0; k < STATS_CONTAINER_COUNT; k++) {
+            printf("%s\n    \"%s\": {\"allocations\": %llu, \"frees\": %llu, \"liveBytes\": %lld, "
+                   "\"traversals\": %llu, \"nodesVisited\": %llu, \"highWater\": %lld}",
+                   k == 0 ? "" : ",", containerStatsName((StatsContainer)k), stats[k].allocations,
+                   stats[k].frees, stats[k].liveBytes, stats[k].traversals, stats[k].nodesVisited,
+                   stats[k].highWater);
+        }
+        printf("\n  }");
+    }
+    printf("\n}\n");
+    return 0;
+}
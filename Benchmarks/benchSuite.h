@@ -0,0 +1,45 @@
+/**
+ * @file benchSuite.h
+ * @brief Shared pieces of the data structure benchmark suite
+ * @note linkedList.h and duLinkedList.h both define Status, so every structure is
+ *       measured in its own translation unit and reports through benchRecord.
+ */
+
+#ifndef BENCH_SUITE_H
+#define BENCH_SUITE_H
+
+#define BENCH_WORK 10000000L   /**< Elements touched per measurement, spread over repetitions */
+#define BENCH_MAX_REPS 1000    /**< Upper bound on repetitions for the smallest sizes */
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+double benchNow(void);
+
+/**
+ * @brief Number of repetitions for a size, about BENCH_WORK elements in total
+ */
+int benchRepetitions(long size);
+
+/**
+ * @brief Emit one result as a JSON object
+ * @param structure Structure measured, e.g. "linkedList"
+ * @param operation Operation measured, e.g. "build"
+ * @param size Elements in the structure
+ * @param repetitions Number of timed runs
+ * @param best Fastest run in seconds
+ * @param total Sum of all runs in seconds
+ */
+void benchRecord(const char* structure, const char* operation, long size, int repetitions,
+                 double best, double total);
+
+/**
+ * @brief Sink for computed values, so the compiler cannot drop the work that produced them
+ */
+extern volatile long long benchSink;
+
+void benchLinkedList(long size, long maxRecursive);
+void benchDuLinkedList(long size);
+void benchLinkedStack(long size);
+
+#endif /* BENCH_SUITE_H */
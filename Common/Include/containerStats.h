@@ -0,0 +1,191 @@
+/**
+ * @file containerStats.h
+ * @brief Optional operation counters for the list and stack containers
+ * @note Compiled in only when CONTAINER_STATS is defined; otherwise every STATS_ macro
+ *       expands to nothing and the containers are built exactly as without this header.
+ *       Each thread counts into its own cache-line aligned block, written with relaxed
+ *       loads and stores only, so counting takes no lock and no atomic read-modify-write.
+ *       A snapshot sums the blocks of all threads, live and exited, and is exact once the
+ *       counted threads are quiet; while they run it may lag by the operations in flight.
+ *       Counts made by thread-exit destructors that run after the block was released go
+ *       to a block registered again for them, so they are not lost either.
+ */
+
+#ifndef CONTAINER_STATS_H
+#define CONTAINER_STATS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Containers that are counted
+ */
+typedef enum {
+    STATS_LINKED_LIST,      /**< linkedList.c */
+    STATS_DU_LINKED_LIST,   /**< duLinkedList.c */
+    STATS_LINKED_STACK,     /**< linkedStack.c and arrayStack.c */
+    STATS_CONTAINER_COUNT
+} StatsContainer;
+
+/**
+ * @brief Counters of one container, summed over all threads
+ * @note For the lists a node is counted as allocated when it enters a list, through
+ *       InitList or an insertion, since callers allocate the nodes they insert, and as
+ *       freed when the list frees it. The stack counts its own heap blocks; nodes reused
+ *       from its per-thread cache are not allocations.
+ */
+typedef struct {
+    unsigned long long allocations;   /**< Nodes or blocks acquired */
+    unsigned long long frees;         /**< Nodes or blocks released */
+    long long liveBytes;              /**< Bytes acquired and not yet released */
+    unsigned long long traversals;    /**< Traversal and search calls */
+    unsigned long long nodesVisited;  /**< Nodes those calls visited */
+    long long highWater;              /**< Deepest stack seen, stacks only */
+} ContainerStats;
+
+/**
+ * @brief Receives a snapshot of every container
+ * @param stats One entry per StatsContainer
+ * @param arg Argument given to containerStatsStartDump
+ */
+typedef void (*ContainerStatsHook)(const ContainerStats* stats, void* arg);
+
+/**
+ * @brief Check whether the counters are compiled in
+ * @return true if CONTAINER_STATS was defined
+ */
+bool containerStatsEnabled(void);
+
+/**
+ * @brief Name of a container, for reports
+ * @param container Container
+ * @return Static string such as "linkedList"
+ */
+const char* containerStatsName(StatsContainer container);
+
+/**
+ * @brief Take a snapshot of all counters
+ * @param stats Receives STATS_CONTAINER_COUNT entries, all zero when not compiled in
+ */
+void containerStatsSnapshot(ContainerStats* stats);
+
+/**
+ * @brief Call a hook with a fresh snapshot at a fixed interval, on a background thread
+ * @param hook Hook to call, containerStatsPrint writes a text report
+ * @param arg Passed to the hook
+ * @param intervalMs Milliseconds between two calls
+ * @return true if started, false if not compiled in, already running or the thread failed
+ */
+bool containerStatsStartDump(ContainerStatsHook hook, void* arg, unsigned intervalMs);
+
+/**
+ * @brief Stop the periodic dump and wait for the background thread
+ * @note The hook is called a last time before the thread exits
+ */
+void containerStatsStopDump(void);
+
+/**
+ * @brief Hook writing one line per container
+ * @param stats One entry per StatsContainer
+ * @param arg FILE* to write to, stderr if NULL
+ */
+void containerStatsPrint(const ContainerStats* stats, void* arg);
+
+#ifdef CONTAINER_STATS
+
+#include <stdatomic.h>
+
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#define STATS_THREAD_LOCAL _Thread_local
+#else
+#define STATS_THREAD_LOCAL __thread
+#endif
+
+/**
+ * @brief Counters of one container in one thread, only ever written by that thread
+ */
+typedef struct {
+    atomic_ullong allocations;
+    atomic_ullong frees;
+    atomic_ullong liveBytes;          /**< Wraps below zero when another thread frees, the sum does not */
+    atomic_ullong traversals;
+    atomic_ullong nodesVisited;
+    atomic_ullong highWater;
+} StatsCounters;
+
+/**
+ * @brief Counters of one thread, kept after the thread exits and reused by a later one
+ */
+typedef struct StatsBlock {
+    StatsCounters counters[STATS_CONTAINER_COUNT];
+    atomic_int inUse;
+    struct StatsBlock* next;
+} StatsBlock;
+
+extern STATS_THREAD_LOCAL StatsBlock* statsThreadBlock;
+
+/**
+ * @brief Register the calling thread, slow path of statsCounters
+ */
+StatsBlock* statsRegisterThread(void);
+
+static inline StatsCounters* statsCounters(StatsContainer container) {
+    StatsBlock* block = statsThreadBlock;
+    if (block == NULL) {
+        block = statsRegisterThread();
+    }
+    return &block->counters[container];
+}
+
+/**
+ * @brief counter += delta, safe because only the owning thread writes the counter
+ */
+static inline void statsAdd(atomic_ullong* counter, unsigned long long delta) {
+    atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + delta,
+                          memory_order_relaxed);
+}
+
+static inline void statsOnAlloc(StatsContainer container, unsigned long long count, size_t bytes) {
+    StatsCounters* c = statsCounters(container);
+    statsAdd(&c->allocations, count);
+    statsAdd(&c->liveBytes, bytes);
+}
+
+static inline void statsOnFree(StatsContainer container, unsigned long long count, size_t bytes) {
+    StatsCounters* c = statsCounters(container);
+    statsAdd(&c->frees, count);
+    statsAdd(&c->liveBytes, 0ull - bytes);
+}
+
+static inline void statsOnVisit(StatsContainer container, unsigned long long nodes) {
+    StatsCounters* c = statsCounters(container);
+    statsAdd(&c->traversals, 1);
+    statsAdd(&c->nodesVisited, nodes);
+}
+
+static inline void statsOnDepth(StatsContainer container, unsigned long long depth) {
+    StatsCounters* c = statsCounters(container);
+    if (depth > atomic_load_explicit(&c->highWater, memory_order_relaxed)) {
+        atomic_store_explicit(&c->highWater, depth, memory_order_relaxed);
+    }
+}
+
+#define STATS_ALLOC(container, count, bytes) statsOnAlloc(container, count, bytes)
+#define STATS_FREE(container, count, bytes) statsOnFree(container, count, bytes)
+#define STATS_VISIT(container, nodes) statsOnVisit(container, nodes)
+#define STATS_DEPTH(container, depth) statsOnDepth(container, (unsigned long long)(depth))
+#define STATS_COUNTER(name) unsigned long long name = 0
+#define STATS_STEP(name) ((name)++)
+
+#else
+
+#define STATS_ALLOC(container, count, bytes) ((void)0)
+#define STATS_FREE(container, count, bytes) ((void)0)
+#define STATS_VISIT(container, nodes) ((void)0)
+#define STATS_DEPTH(container, depth) ((void)0)
+#define STATS_COUNTER(name)
+#define STATS_STEP(name) ((void)0)
+
+#endif /* CONTAINER_STATS */
+
+#endif /* CONTAINER_STATS_H */
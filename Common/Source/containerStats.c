@@ -0,0 +1,213 @@
+/**
+ * @file containerStats.c
+ * @brief Per-thread counter registry, snapshots and the periodic dump thread
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "containerStats.h"
+
+#ifdef CONTAINER_STATS
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+
+#define STATS_BLOCK_ALIGN 64  /**< Blocks of different threads never share a cache line */
+
+STATS_THREAD_LOCAL StatsBlock* statsThreadBlock = NULL;
+
+static _Atomic(StatsBlock*) blocks = NULL;   /**< Every block ever registered, never freed */
+static StatsBlock fallbackBlock;             /**< Shared by threads whose block could not be allocated */
+static pthread_mutex_t registryLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t keyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t exitKey;
+
+/**
+ * @brief Periodic dump state
+ */
+static struct {
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_t thread;
+    ContainerStatsHook hook;
+    void* arg;
+    unsigned intervalMs;
+    bool running;
+    bool stop;
+} dump = {.lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER};
+
+/**
+ * @brief Thread exit: the block keeps its counts and becomes free for the next new thread
+ * @note Destructors of other keys may still count after this one, such as the stack cache
+ *       drain. The thread drops its pointer first, so those counts register a block of their
+ *       own, released in the next destructor round, instead of writing into a block that a
+ *       new thread may already own
+ */
+static void releaseBlock(void* block) {
+    statsThreadBlock = NULL;
+    atomic_store(&((StatsBlock*)block)->inUse, 0);
+}
+
+static void createKey(void) {
+    pthread_key_create(&exitKey, releaseBlock);
+}
+
+StatsBlock* statsRegisterThread(void) {
+    StatsBlock* block;
+
+    pthread_once(&keyOnce, createKey);
+    pthread_mutex_lock(&registryLock);
+    for (block = atomic_load(&blocks); block != NULL; block = block->next) {
+        if (!atomic_load(&block->inUse)) {
+            break;
+        }
+    }
+    if (block == NULL) {
+        block = (StatsBlock*)aligned_alloc(STATS_BLOCK_ALIGN,
+                                           (sizeof(StatsBlock) + STATS_BLOCK_ALIGN - 1) /
+                                           STATS_BLOCK_ALIGN * STATS_BLOCK_ALIGN);
+        if (block != NULL) {
+            memset(block, 0, sizeof(StatsBlock));
+            block->next = atomic_load(&blocks);
+            atomic_store(&blocks, block);  // Published last, snapshots walk without the lock
+        }
+    }
+    if (block != NULL) {
+        atomic_store(&block->inUse, 1);
+    }
+    pthread_mutex_unlock(&registryLock);
+
+    if (block == NULL) {
+        block = &fallbackBlock;  // Counts may be lost between threads sharing it, never corrupted
+    } else {
+        pthread_setspecific(exitKey, block);
+    }
+    statsThreadBlock = block;
+    return block;
+}
+
+/**
+ * @brief Add one thread's counters into a snapshot
+ */
+static void accumulate(ContainerStats* stats, StatsBlock* block) {
+    for (int k = 0; k < STATS_CONTAINER_COUNT; k++) {
+        StatsCounters* c = &block->counters[k];
+        unsigned long long highWater = atomic_load_explicit(&c->highWater, memory_order_relaxed);
+
+        stats[k].allocations += atomic_load_explicit(&c->allocations, memory_order_relaxed);
+        stats[k].frees += atomic_load_explicit(&c->frees, memory_order_relaxed);
+        stats[k].liveBytes += (long long)atomic_load_explicit(&c->liveBytes, memory_order_relaxed);
+        stats[k].traversals += atomic_load_explicit(&c->traversals, memory_order_relaxed);
+        stats[k].nodesVisited += atomic_load_explicit(&c->nodesVisited, memory_order_relaxed);
+        if ((long long)highWater > stats[k].highWater) {
+            stats[k].highWater = (long long)highWater;
+        }
+    }
+}
+
+static void* dumpThread(void* unused) {
+    (void)unused;
+    ContainerStats stats[STATS_CONTAINER_COUNT];
+    struct timespec deadline;
+
+    pthread_mutex_lock(&dump.lock);
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    while (!dump.stop) {
+        deadline.tv_sec += dump.intervalMs / 1000;
+        deadline.tv_nsec += (long)(dump.intervalMs % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while (!dump.stop &&
+               pthread_cond_timedwait(&dump.wake, &dump.lock, &deadline) != ETIMEDOUT) {
+        }
+        pthread_mutex_unlock(&dump.lock);
+        containerStatsSnapshot(stats);
+        dump.hook(stats, dump.arg);
+        pthread_mutex_lock(&dump.lock);
+    }
+    pthread_mutex_unlock(&dump.lock);
+    return NULL;
+}
+#endif /* CONTAINER_STATS */
+
+bool containerStatsEnabled(void) {
+#ifdef CONTAINER_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+const char* containerStatsName(StatsContainer container) {
+    static const char* const names[STATS_CONTAINER_COUNT] = {
+        "linkedList", "duLinkedList", "linkedStack"
+    };
+    return container >= 0 && container < STATS_CONTAINER_COUNT ? names[container] : "unknown";
+}
+
+void containerStatsSnapshot(ContainerStats* stats) {
+    memset(stats, 0, STATS_CONTAINER_COUNT * sizeof(ContainerStats));
+#ifdef CONTAINER_STATS
+    for (StatsBlock* block = atomic_load(&blocks); block != NULL; block = block->next) {
+        accumulate(stats, block);
+    }
+    accumulate(stats, &fallbackBlock);
+#endif
+}
+
+bool containerStatsStartDump(ContainerStatsHook hook, void* arg, unsigned intervalMs) {
+#ifdef CONTAINER_STATS
+    bool started = false;
+
+    pthread_mutex_lock(&dump.lock);
+    if (!dump.running && hook != NULL && intervalMs > 0) {
+        dump.hook = hook;
+        dump.arg = arg;
+        dump.intervalMs = intervalMs;
+        dump.stop = false;
+        started = pthread_create(&dump.thread, NULL, dumpThread, NULL) == 0;
+        dump.running = started;
+    }
+    pthread_mutex_unlock(&dump.lock);
+    return started;
+#else
+    (void)hook;
+    (void)arg;
+    (void)intervalMs;
+    return false;
+#endif
+}
+
+void containerStatsStopDump(void) {
+#ifdef CONTAINER_STATS
+    pthread_mutex_lock(&dump.lock);
+    if (!dump.running) {
+        pthread_mutex_unlock(&dump.lock);
+        return;
+    }
+    dump.stop = true;
+    pthread_cond_signal(&dump.wake);
+    pthread_mutex_unlock(&dump.lock);
+
+    pthread_join(dump.thread, NULL);
+    pthread_mutex_lock(&dump.lock);
+    dump.running = false;
+    pthread_mutex_unlock(&dump.lock);
+#endif
+}
+
+void containerStatsPrint(const ContainerStats* stats, void* arg) {
+    FILE* out = arg != NULL ? (FILE*)arg : stderr;
+
+    for (int k = 0; k < STATS_CONTAINER_COUNT; k++) {
+        fprintf(out, "%-12s allocations %llu frees %llu live %lld bytes, "
+                "%llu traversals visiting %llu nodes, high water %lld\n",
+                containerStatsName((StatsContainer)k), stats[k].allocations, stats[k].frees,
+                stats[k].liveBytes, stats[k].traversals, stats[k].nodesVisited,
+                stats[k].highWater);
+    }
+    fflush(out);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file lruCacheBench.c
+ * @brief Read-through LRU cache under Zipfian key distributions
+ * @note Usage: lruCacheBench [requests] [keys]
+ *       Every request is a Get_Lru, followed by a Put_Lru of a fresh reading on a miss. Keys
+ *       are drawn from a Zipf distribution over the key space (default 1e6 keys, 1e7 requests)
+ *       for several skews and cache sizes; the trace is generated up front so the timing only
+ *       covers the cache. With glibc, the heap in use is compared before and after the timed
+ *       part to show that the cache allocates nothing once initialized.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "lruCache.h"
+
+#define DEFAULT_REQUESTS 10000000L
+#define DEFAULT_KEYS 1000000L
+
+static const double skews[] = {0.6, 0.8, 0.99, 1.2};
+static const double cacheFractions[] = {0.001, 0.01, 0.1};
+
+static uint64_t rngState = 0x9E3779B97F4A7C15ull;
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief xorshift64*, uniform in [0, 1)
+ */
+static double nextUniform(void) {
+    rngState ^= rngState >> 12;
+    rngState ^= rngState << 25;
+    rngState ^= rngState >> 27;
+    return (double)((rngState * 2685821657736338717ull) >> 11) / 9007199254740992.0;
+}
+
+/**
+ * @brief Heap bytes in use, -1 where the C library cannot tell
+ */
+static long long heapInUse(void) {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    return (long long)mallinfo2().uordblks;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Fill trace with keys whose popularity ranks follow Zipf(skew)
+ */
+static void zipfTrace(ElemType *trace, long requests, const ElemType *keyOfRank, double *cdf,
+                      long keys, double skew) {
+    double sum = 0;
+
+    for (long r = 0; r < keys; r++) {
+        sum += 1.0 / pow((double)(r + 1), skew);
+        cdf[r] = sum;
+    }
+    for (long i = 0; i < requests; i++) {
+        double u = nextUniform() * sum;
+        long lo = 0, hi = keys - 1;
+
+        // 第一个累计概率不小于u的排名
+        while (lo < hi) {
+            long mid = lo + (hi - lo) / 2;
+            if (cdf[mid] < u) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        trace[i] = keyOfRank[lo];
+    }
+}
+
+int main(int argc, char *argv[]) {
+    long requests = argc > 1 ? (long)atof(argv[1]) : DEFAULT_REQUESTS;
+    long keys = argc > 2 ? (long)atof(argv[2]) : DEFAULT_KEYS;
+    ElemType *trace = (ElemType *)malloc(requests * sizeof(ElemType));
+    ElemType *keyOfRank = (ElemType *)malloc(keys * sizeof(ElemType));
+    double *cdf = (double *)malloc(keys * sizeof(double));
+
+    if (trace == NULL || keyOfRank == NULL || cdf == NULL || requests < 1 || keys < 1) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    // 热门程度与键值无关，随机打乱排名到键的对应
+    for (long r = 0; r < keys; r++) {
+        keyOfRank[r] = (ElemType)r;
+    }
+    for (long r = keys - 1; r > 0; r--) {
+        long j = (long)(nextUniform() * (r + 1));
+        ElemType temp = keyOfRank[r];
+        keyOfRank[r] = keyOfRank[j];
+        keyOfRank[j] = temp;
+    }
+
+    for (size_t s = 0; s < sizeof(skews) / sizeof(skews[0]); s++) {
+        zipfTrace(trace, requests, keyOfRank, cdf, keys, skews[s]);
+
+        for (size_t f = 0; f < sizeof(cacheFractions) / sizeof(cacheFractions[0]); f++) {
+            size_t capacity = (size_t)(keys * cacheFractions[f]);
+            LruCache cache;
+            LruStats stats;
+            LruValue value;
+            double sink = 0, t;
+            long long heapBefore, heapAfter;
+
+            if (InitLruCache(&cache, capacity > 0 ? capacity : 1) == ERROR) {
+                fprintf(stderr, "out of memory\n");
+                return 1;
+            }
+
+            heapBefore = heapInUse();
+            t = nowSeconds();
+            for (long i = 0; i < requests; i++) {
+                if (Get_Lru(&cache, trace[i], &value) == SUCCESS) {
+                    sink += value;
+                } else {
+                    Put_Lru(&cache, trace[i], (LruValue)i);
+                }
+            }
+            t = nowSeconds() - t;
+            heapAfter = heapInUse();
+
+            GetStats_Lru(&cache, &stats);
+            printf("zipf=%.2f capacity=%-7zu %.1fns/request hitRatio=%.4f hits=%llu misses=%llu "
+                   "evictions=%llu heapGrowth=%lldB%s\n",
+                   skews[s], cache.capacity, t / requests * 1e9,
+                   (double)stats.hits / (stats.hits + stats.misses), stats.hits, stats.misses,
+                   stats.evictions, heapAfter - heapBefore, sink == -1 ? " " : "");
+            DestroyLruCache(&cache);
+        }
+    }
+
+    free(trace);
+    free(keyOfRank);
+    free(cdf);
+    return 0;
+}
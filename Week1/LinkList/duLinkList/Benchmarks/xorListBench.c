@@ -0,0 +1,220 @@
+/**
+ * @file xorListBench.c
+ * @brief Compare DuLNode lists against the xor linked list in memory and throughput
+ * @note Linux only: every run happens in a forked child so that its peak RSS can be read
+ *       back with wait4(). Usage: xorListBench [nodes]
+ *       DuLNode runs once with a malloc per node, the way Week1 builds lists, and once from
+ *       a DuNodePool, so that the 24 against 16 bytes per node is seen without malloc's
+ *       rounding of both to 32. The edit pass deletes every other node and then inserts a
+ *       node before each one left, walking the list both times.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include "duLinkedList.h"
+#include "duNodePool.h"
+#include "duXorList.h"
+
+#define DEFAULT_NODES 10000000L
+
+enum { BUILD, FORWARD, BACKWARD, EDIT, DESTROY, PHASES };
+
+static const char *const phaseNames[PHASES] = {"build", "forward", "backward", "edit", "destroy"};
+
+static long long visitSum = 0;
+static DuNodePool pool;
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void visitElement(ElemType e) {
+    visitSum += e;
+}
+
+static DuLNode *mallocNode(ElemType e) {
+    DuLNode *node = (DuLNode *)malloc(sizeof(DuLNode));
+    if (node == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    node->data = e;
+    node->prior = NULL;
+    node->next = NULL;
+    return node;
+}
+
+static DuLNode *poolNode(ElemType e) {
+    DuLNode *node = AllocNode_DuL(&pool, e);
+    if (node == NULL) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    return node;
+}
+
+static Status poolDelete(DuLNode *p, ElemType *e) {
+    return DeleteListPool_DuL(&pool, p, e);
+}
+
+/**
+ * @brief Run every phase on a NULL-terminated DuLNode list with the given allocator
+ */
+static void runDuL(long n, double *times, DuLNode *(*alloc)(ElemType),
+                   Status (*deleteNext)(DuLNode *, ElemType *)) {
+    DuLinkedList L;
+    DuLNode *tail, *p;
+    ElemType e;
+    double t0 = nowSeconds();
+
+    InitList_DuL(&L);
+    tail = L;
+    for (long i = 0; i < n; i++) {
+        DuLNode *node = alloc((ElemType)i);
+        InsertAfterList_DuL(tail, node);
+        tail = node;
+    }
+    times[BUILD] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    TraverseList_DuL(L, visitElement);
+    times[FORWARD] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (p = tail; p != L; p = p->prior) {
+        visitSum += p->data;
+    }
+    times[BACKWARD] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (p = L; p != NULL && p->next != NULL; p = p->next) {
+        deleteNext(p, &e);
+        visitSum += e;
+    }
+    for (p = L->next; p != NULL; p = p->next) {
+        InsertBeforeList_DuL(p, alloc((ElemType)0));
+    }
+    times[EDIT] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    if (deleteNext == DeleteList_DuL) {
+        DestroyList_DuL(&L);
+    } else {
+        free(L);
+        DestroyDuNodePool(&pool);
+    }
+    times[DESTROY] = nowSeconds() - t0;
+}
+
+static void runMalloc(long n, double *times) {
+    runDuL(n, times, mallocNode, DeleteList_DuL);
+}
+
+static void runPool(long n, double *times) {
+    InitDuNodePool(&pool, 0);
+    runDuL(n, times, poolNode, poolDelete);
+}
+
+/**
+ * @brief Run every phase on the xor linked list
+ */
+static void runXor(long n, double *times) {
+    XorList_DuL L;
+    XorCursor_DuL c;
+    ElemType e;
+    double t0 = nowSeconds();
+
+    InitList_XDuL(&L, 0);
+    CursorEnd_XDuL(&L, &c);
+    for (long i = 0; i < n; i++) {
+        if (InsertBefore_XDuL(&L, &c, (ElemType)i) == ERROR) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    times[BUILD] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    TraverseList_XDuL(&L, visitElement);
+    times[FORWARD] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    TraverseListBack_XDuL(&L, visitElement);
+    times[BACKWARD] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (CursorFront_XDuL(&L, &c); DeleteAt_XDuL(&L, &c, &e) == SUCCESS;) {
+        visitSum += e;
+        CursorNext_XDuL(&L, &c);
+    }
+    for (CursorFront_XDuL(&L, &c); !CursorAtEnd_XDuL(&L, &c); CursorNext_XDuL(&L, &c)) {
+        InsertBefore_XDuL(&L, &c, (ElemType)0);
+    }
+    times[EDIT] = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    DestroyList_XDuL(&L);
+    times[DESTROY] = nowSeconds() - t0;
+}
+
+/**
+ * @brief Run one mode in a child process and report its timings and peak RSS
+ */
+static void runChild(const char *name, void (*run)(long, double *), long n) {
+    int fds[2];
+    double times[PHASES] = {0};
+    struct rusage usage;
+    pid_t pid;
+    int status;
+
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        return;
+    }
+
+    pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        run(n, times);
+        if (visitSum == 42) {
+            fputc('\0', stderr);  // Keeps the walks from being optimized away
+        }
+        if (write(fds[1], times, sizeof(times)) != (ssize_t)sizeof(times)) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+
+    close(fds[1]);
+    if (read(fds[0], times, sizeof(times)) != (ssize_t)sizeof(times)) {
+        fprintf(stderr, "%s: child produced no result\n", name);
+    }
+    close(fds[0]);
+    wait4(pid, &status, 0, &usage);
+
+    printf("%-8s nodes=%ld", name, n);
+    for (int k = 0; k < PHASES; k++) {
+        printf(" %s=%.1fns", phaseNames[k], times[k] / n * 1e9);
+    }
+    printf(" peakRSS=%ldKB (%.1f bytes/node)\n", usage.ru_maxrss, usage.ru_maxrss * 1024.0 / n);
+}
+
+int main(int argc, char *argv[]) {
+    long n = argc > 1 ? (long)atof(argv[1]) : DEFAULT_NODES;
+
+    printf("node size: DuLNode %zu bytes, XorNode %zu bytes\n", sizeof(DuLNode), sizeof(XorNode));
+    runChild("malloc", runMalloc, n);
+    runChild("pool", runPool, n);
+    runChild("xor", runXor, n);
+    return 0;
+}
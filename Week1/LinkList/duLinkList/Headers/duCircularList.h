@@ -0,0 +1,167 @@
+/***************************************************************************************
+ *	File Name				:	duCircularList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision
+ *History-------------------------------------- No	version		Data
+ *Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+/**************************************************************
+ *	Multi-Include-Prevent Section
+ **************************************************************/
+
+#ifndef DUCIRCULARLIST_H_INCLUDED
+#define DUCIRCULARLIST_H_INCLUDED
+
+#include "duLinkedList.h"
+
+/**************************************************************
+ *	Struct Define Section
+ **************************************************************/
+
+// a circular list is a DuLNode sentinel whose prior is the last node and
+// whose next is the first node, an empty list points to itself both ways, so
+// no link is ever NULL and the tail is one step away from the sentinel
+typedef DuLinkedList CircularList_DuL;
+
+/**************************************************************
+ *	Prototype Declare Section
+ **************************************************************/
+
+/**
+ *  @name        : Status InitList_CDuL(CircularList_DuL *L)
+ *	@description : initialize an empty circular list, only the sentinel
+ *	@param		 : L(the sentinel)
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InitList_CDuL(CircularList_DuL *L);
+
+/**
+ *  @name        : void DestroyList_CDuL(CircularList_DuL *L)
+ *	@description : free every node and the sentinel
+ *	@param		 : L(the sentinel), set to NULL
+ *	@return		 : void
+ *  @notice      : None
+ */
+void DestroyList_CDuL(CircularList_DuL *L);
+
+/**
+ *  @name        : int IsEmpty_CDuL(CircularList_DuL L)
+ *	@description : check whether the list has no node
+ *	@param		 : L(the sentinel)
+ *	@return		 : 1 if empty, 0 otherwise
+ *  @notice      : None
+ */
+int IsEmpty_CDuL(CircularList_DuL L);
+
+/**
+ *  @name        : void InsertBefore_CDuL(DuLNode *p, DuLNode *q)
+ *	@description : link node q before node p, p may be the sentinel to append
+ *	@param		 : p, q
+ *	@return		 : void
+ *  @notice      : O(1), no NULL branch
+ */
+void InsertBefore_CDuL(DuLNode *p, DuLNode *q);
+
+/**
+ *  @name        : void InsertAfter_CDuL(DuLNode *p, DuLNode *q)
+ *	@description : link node q after node p, p may be the sentinel to prepend
+ *	@param		 : p, q
+ *	@return		 : void
+ *  @notice      : O(1), no NULL branch
+ */
+void InsertAfter_CDuL(DuLNode *p, DuLNode *q);
+
+/**
+ *  @name        : void Unlink_CDuL(DuLNode *p)
+ *	@description : take node p out of its list without freeing it
+ *	@param		 : p(not a sentinel)
+ *	@return		 : void
+ *  @notice      : O(1), p points to itself afterwards
+ */
+void Unlink_CDuL(DuLNode *p);
+
+/**
+ *  @name        : Status PushFront_CDuL(CircularList_DuL L, ElemType e)
+ *	@description : allocate a node holding e and make it the first node
+ *	@param		 : L(the sentinel), e
+ *	@return		 : Status(ERROR if out of memory)
+ *  @notice      : O(1)
+ */
+Status PushFront_CDuL(CircularList_DuL L, ElemType e);
+
+/**
+ *  @name        : Status PushBack_CDuL(CircularList_DuL L, ElemType e)
+ *	@description : allocate a node holding e and make it the last node
+ *	@param		 : L(the sentinel), e
+ *	@return		 : Status(ERROR if out of memory)
+ *  @notice      : O(1)
+ */
+Status PushBack_CDuL(CircularList_DuL L, ElemType e);
+
+/**
+ *  @name        : Status PopFront_CDuL(CircularList_DuL L, ElemType *e)
+ *	@description : remove the first node, free it and assign its value to e
+ *	@param		 : L(the sentinel), e
+ *	@return		 : Status(ERROR if empty)
+ *  @notice      : O(1)
+ */
+Status PopFront_CDuL(CircularList_DuL L, ElemType *e);
+
+/**
+ *  @name        : Status PopBack_CDuL(CircularList_DuL L, ElemType *e)
+ *	@description : remove the last node, free it and assign its value to e
+ *	@param		 : L(the sentinel), e
+ *	@return		 : Status(ERROR if empty)
+ *  @notice      : O(1)
+ */
+Status PopBack_CDuL(CircularList_DuL L, ElemType *e);
+
+/**
+ *  @name        : void Splice_CDuL(DuLNode *pos, DuLNode *first, DuLNode *last)
+ *	@description : move the range first..last, taken from any list, before pos
+ *	@param		 : pos(node or sentinel of the target list), first, last(inclusive)
+ *	@return		 : void
+ *  @notice      : O(1), last must follow or equal first in its list, the
+ *range must not contain a sentinel or pos
+ */
+void Splice_CDuL(DuLNode *pos, DuLNode *first, DuLNode *last);
+
+/**
+ *  @name        : void Concat_CDuL(CircularList_DuL L, CircularList_DuL other)
+ *	@description : move every node of other to the end of L
+ *	@param		 : L, other(left empty)
+ *	@return		 : void
+ *  @notice      : O(1)
+ */
+void Concat_CDuL(CircularList_DuL L, CircularList_DuL other);
+
+/**
+ *  @name        : void Split_CDuL(CircularList_DuL L, DuLNode *p, CircularList_DuL tail)
+ *	@description : move p and every node after it to the end of tail
+ *	@param		 : L, p(a node of L), tail(an initialized list)
+ *	@return		 : void
+ *  @notice      : O(1)
+ */
+void Split_CDuL(CircularList_DuL L, DuLNode *p, CircularList_DuL tail);
+
+/**
+ *  @name        : void TraverseList_CDuL(CircularList_DuL L, void (*visit)(ElemType e))
+ *	@description : call visit on every value from the first node to the last
+ *	@param		 : L(the sentinel), visit
+ *	@return		 : void
+ *  @notice      : None
+ */
+void TraverseList_CDuL(CircularList_DuL L, void (*visit)(ElemType e));
+
+/**************************************************************
+ *	End-Multi-Include-Prevent Section
+ **************************************************************/
+#endif
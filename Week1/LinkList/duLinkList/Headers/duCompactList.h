@@ -0,0 +1,101 @@
+/***************************************************************************************
+ *	File Name				:	duCompactList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision
+ *History-------------------------------------- No	version		Data
+ *Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+/**************************************************************
+ *	Multi-Include-Prevent Section
+ **************************************************************/
+
+#ifndef DUCOMPACTLIST_H_INCLUDED
+#define DUCOMPACTLIST_H_INCLUDED
+
+#include "duLinkedList.h"
+#include "duNodePool.h"
+
+/**************************************************************
+ *	Macro Define Section
+ **************************************************************/
+
+// a link that moves forward by at most this many bytes stays within the next
+// cache line, malloc headers between consecutive nodes are not fragmentation
+#define DU_COMPACT_NEAR_BYTES 64
+
+/**************************************************************
+ *	Struct Define Section
+ **************************************************************/
+
+// define struct of the automatic relayout trigger
+typedef struct DuCompactPolicy {
+  double threshold;
+  unsigned long interval;
+  unsigned long pending;
+  unsigned long compactions;
+} DuCompactPolicy;
+
+/**************************************************************
+ *	Prototype Declare Section
+ **************************************************************/
+
+/**
+ *  @name        : double ListFragmentation_DuL(DuLinkedList L)
+ *	@description : fraction of links that point backwards in memory or more
+ *than DU_COMPACT_NEAR_BYTES forwards
+ *	@param		 : L(the head node)
+ *	@return		 : 0.0 for a list laid out in order, from a pool or from malloc,
+ *close to 1.0 when scattered
+ *  @notice      : O(n), works on any list
+ */
+double ListFragmentation_DuL(DuLinkedList L);
+
+/**
+ *  @name        : Status CompactList_DuL(DuNodePool *pool, DuLinkedList *L)
+ *	@description : copy the list in order into one contiguous slab, rewrite
+ *prior and next, and release the old nodes
+ *	@param		 : pool(owner of the nodes, replaced), L(the head node, replaced)
+ *	@return		 : status
+ *  @notice      : pool must hold no other list; a pool without slabs means the
+ *nodes came from malloc and they are freed one by one; pointers into the old
+ *list become invalid. Either way the nodes belong to pool afterwards, so insert
+ *and delete only through InsertListPool_DuL and DeleteListPool_DuL from then on
+ */
+Status CompactList_DuL(DuNodePool *pool, DuLinkedList *L);
+
+/**
+ *  @name        : void InitCompactPolicy_DuL(DuCompactPolicy *policy, double
+ *threshold, unsigned long interval)
+ *	@description : set up an automatic relayout trigger
+ *	@param		 : policy, threshold, interval
+ *	@return		 : void
+ *  @notice      : None
+ */
+void InitCompactPolicy_DuL(DuCompactPolicy *policy, double threshold,
+                           unsigned long interval);
+
+/**
+ *  @name        : Status NoteListMutation_DuL(DuCompactPolicy *policy,
+ *DuNodePool *pool, DuLinkedList *L)
+ *	@description : call after each InsertListPool_DuL/DeleteListPool_DuL on L,
+ *relayout once the measured fragmentation is above the threshold
+ *	@param		 : policy, pool(owner of every node of L), L(the head node)
+ *	@return		 : status
+ *  @notice      : runs on the caller's thread; InsertAfterList_DuL with a
+ *malloc'd node or DeleteList_DuL must not be used on L, they would mix malloc'd
+ *nodes into the pool's list or free a node inside a slab
+ */
+Status NoteListMutation_DuL(DuCompactPolicy *policy, DuNodePool *pool,
+                            DuLinkedList *L);
+
+/**************************************************************
+ *	End-Multi-Include-Prevent Section
+ **************************************************************/
+#endif
@@ -104,6 +104,19 @@ Status DeleteList_DuL(DuLNode *p, ElemType *e);
  */
 void TraverseList_DuL(DuLinkedList L, void (*visit)(ElemType e));
 
+/**
+ *  @name        : void TraverseListBatch_DuL(DuLinkedList L, ElemType *buffer, int size,
+ *                 void (*visit)(const ElemType *block, int n))
+ *	@description : traverse the linked list, gather up to size values into
+ *buffer and call visit once per block
+ *	@param		 : L(the head node), buffer, size(capacity of buffer), visit
+ *	@return		 : void
+ *  @notice      : saves the per-node visit call only, the walk is still one
+ *dependent load per node
+ */
+void TraverseListBatch_DuL(DuLinkedList L, ElemType *buffer, int size,
+                           void (*visit)(const ElemType *block, int n));
+
 /**************************************************************
  *	End-Multi-Include-Prevent Section
  **************************************************************/
@@ -0,0 +1,116 @@
+/***************************************************************************************
+ *	File Name				:	duNodePool.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision
+ *History-------------------------------------- No	version		Data
+ *Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+/**************************************************************
+ *	Multi-Include-Prevent Section
+ **************************************************************/
+
+#ifndef DUNODEPOOL_H_INCLUDED
+#define DUNODEPOOL_H_INCLUDED
+
+#include <stddef.h>
+#include "duLinkedList.h"
+
+/**************************************************************
+ *	Macro Define Section
+ **************************************************************/
+
+// default number of nodes carved out of one slab
+#define DU_NODE_POOL_DEFAULT_SLAB 4096
+
+/**************************************************************
+ *	Struct Define Section
+ **************************************************************/
+
+// define struct of a contiguous block of nodes
+typedef struct DuNodeSlab {
+  struct DuNodeSlab *next;
+  size_t capacity;
+  DuLNode nodes[];
+} DuNodeSlab;
+
+// define struct of node pool, freed nodes are chained through next
+typedef struct DuNodePool {
+  DuNodeSlab *slabs;
+  DuLNode *freeList;
+  size_t slabNodes;
+  size_t bump;
+  size_t live;
+} DuNodePool;
+
+/**************************************************************
+ *	Prototype Declare Section
+ **************************************************************/
+
+/**
+ *  @name        : Status InitDuNodePool(DuNodePool *pool, size_t slabNodes)
+ *	@description : initialize an empty node pool
+ *	@param		 : pool, slabNodes(nodes per slab, 0 means
+ *DU_NODE_POOL_DEFAULT_SLAB)
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InitDuNodePool(DuNodePool *pool, size_t slabNodes);
+
+/**
+ *  @name        : void DestroyDuNodePool(DuNodePool *pool)
+ *	@description : free every slab, all nodes from the pool become invalid
+ *	@param		 : pool
+ *	@return		 : void
+ *  @notice      : None
+ */
+void DestroyDuNodePool(DuNodePool *pool);
+
+/**
+ *  @name        : DuLNode *AllocNode_DuL(DuNodePool *pool, ElemType e)
+ *	@description : take a node from the pool and set its value to e
+ *	@param		 : pool, e
+ *	@return		 : DuLNode(NULL if out of memory)
+ *  @notice      : None
+ */
+DuLNode *AllocNode_DuL(DuNodePool *pool, ElemType e);
+
+/**
+ *  @name        : void FreeNode_DuL(DuNodePool *pool, DuLNode *node)
+ *	@description : give a node back to the pool
+ *	@param		 : pool, node
+ *	@return		 : void
+ *  @notice      : node must come from the same pool
+ */
+void FreeNode_DuL(DuNodePool *pool, DuLNode *node);
+
+/**
+ *  @name        : Status InsertListPool_DuL(DuNodePool *pool, DuLNode *p,
+ *ElemType e)
+ *	@description : take a node holding e from the pool and insert it after p
+ *	@param		 : pool, p, e
+ *	@return		 : status(ERROR if out of memory)
+ *  @notice      : None
+ */
+Status InsertListPool_DuL(DuNodePool *pool, DuLNode *p, ElemType e);
+
+/**
+ *  @name        : Status DeleteListPool_DuL(DuNodePool *pool, DuLNode *p,
+ *ElemType *e)
+ *	@description : same as DeleteList_DuL, but the node goes back to the pool
+ *	@param		 : pool, p, e
+ *	@return		 : status
+ *  @notice      : None
+ */
+Status DeleteListPool_DuL(DuNodePool *pool, DuLNode *p, ElemType *e);
+
+/**************************************************************
+ *	End-Multi-Include-Prevent Section
+ **************************************************************/
+#endif
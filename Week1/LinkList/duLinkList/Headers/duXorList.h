@@ -0,0 +1,216 @@
+/***************************************************************************************
+ *	File Name				:	duXorList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision
+ *History-------------------------------------- No	version		Data
+ *Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+/**************************************************************
+ *	Multi-Include-Prevent Section
+ **************************************************************/
+
+#ifndef DUXORLIST_H_INCLUDED
+#define DUXORLIST_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include "duLinkedList.h"
+
+/**************************************************************
+ *	Macro Define Section
+ **************************************************************/
+
+// default number of nodes carved out of one slab
+#define XOR_LIST_DEFAULT_SLAB 4096
+
+/**************************************************************
+ *	Struct Define Section
+ **************************************************************/
+
+// define struct of xor linked node, link is the address of the previous node
+// xor the address of the next node, 16 bytes against 24 for a DuLNode
+typedef struct XorNode {
+  ElemType data;
+  uintptr_t link;
+} XorNode;
+
+// define struct of a contiguous block of nodes
+typedef struct XorNodeSlab {
+  struct XorNodeSlab *next;
+  size_t capacity;
+  XorNode nodes[];
+} XorNodeSlab;
+
+// define struct of xor linked list, head and tail are sentinels so that every
+// node has two neighbours, nodes come from the list's own slabs because malloc
+// would round a 16 byte node up to the same 32 byte chunk as a DuLNode
+typedef struct XorList_DuL {
+  XorNode head, tail;
+  XorNodeSlab *slabs;
+  XorNode *freeList;
+  size_t slabNodes;
+  size_t bump;
+  size_t length;
+} XorList_DuL;
+
+// define struct of cursor, a node alone cannot be followed without the address
+// of one neighbour, so the cursor keeps the node before cur as well; cur is the
+// tail sentinel when the cursor is past the last node
+typedef struct XorCursor_DuL {
+  XorNode *prev, *cur;
+} XorCursor_DuL;
+
+/**************************************************************
+ *	Prototype Declare Section
+ **************************************************************/
+
+/**
+ *  @name        : Status InitList_XDuL(XorList_DuL *L, size_t slabNodes)
+ *	@description : initialize an empty xor linked list
+ *	@param		 : L, slabNodes(nodes per slab, 0 means XOR_LIST_DEFAULT_SLAB)
+ *	@return		 : Status
+ *  @notice      : the sentinels live inside L, so L must not be copied or moved
+ */
+Status InitList_XDuL(XorList_DuL *L, size_t slabNodes);
+
+/**
+ *  @name        : void DestroyList_XDuL(XorList_DuL *L)
+ *	@description : free every slab, the list is empty afterwards
+ *	@param		 : L
+ *	@return		 : void
+ *  @notice      : cursors into L become invalid
+ */
+void DestroyList_XDuL(XorList_DuL *L);
+
+/**
+ *  @name        : size_t ListLength_XDuL(const XorList_DuL *L)
+ *	@description : number of nodes
+ *	@param		 : L
+ *	@return		 : length
+ *  @notice      : O(1)
+ */
+size_t ListLength_XDuL(const XorList_DuL *L);
+
+/**
+ *  @name        : void CursorFront_XDuL(XorList_DuL *L, XorCursor_DuL *c)
+ *	@description : place the cursor on the first node, or past the end if empty
+ *	@param		 : L, c
+ *	@return		 : void
+ *  @notice      : None
+ */
+void CursorFront_XDuL(XorList_DuL *L, XorCursor_DuL *c);
+
+/**
+ *  @name        : void CursorEnd_XDuL(XorList_DuL *L, XorCursor_DuL *c)
+ *	@description : place the cursor past the last node, inserting before it
+ *appends
+ *	@param		 : L, c
+ *	@return		 : void
+ *  @notice      : None
+ */
+void CursorEnd_XDuL(XorList_DuL *L, XorCursor_DuL *c);
+
+/**
+ *  @name        : int CursorAtEnd_XDuL(const XorList_DuL *L, const
+ *XorCursor_DuL *c)
+ *	@description : check whether the cursor is past the last node
+ *	@param		 : L, c
+ *	@return		 : 1 if past the end, 0 otherwise
+ *  @notice      : None
+ */
+int CursorAtEnd_XDuL(const XorList_DuL *L, const XorCursor_DuL *c);
+
+/**
+ *  @name        : Status CursorNext_XDuL(XorList_DuL *L, XorCursor_DuL *c)
+ *	@description : move the cursor to the next node
+ *	@param		 : L, c
+ *	@return		 : Status(ERROR if already past the end)
+ *  @notice      : O(1)
+ */
+Status CursorNext_XDuL(XorList_DuL *L, XorCursor_DuL *c);
+
+/**
+ *  @name        : Status CursorPrev_XDuL(XorList_DuL *L, XorCursor_DuL *c)
+ *	@description : move the cursor to the previous node
+ *	@param		 : L, c
+ *	@return		 : Status(ERROR if already on the first node)
+ *  @notice      : O(1)
+ */
+Status CursorPrev_XDuL(XorList_DuL *L, XorCursor_DuL *c);
+
+/**
+ *  @name        : Status CursorGet_XDuL(const XorList_DuL *L, const
+ *XorCursor_DuL *c, ElemType *e)
+ *	@description : assign the value under the cursor to e
+ *	@param		 : L, c, e
+ *	@return		 : Status(ERROR if past the end)
+ *  @notice      : None
+ */
+Status CursorGet_XDuL(const XorList_DuL *L, const XorCursor_DuL *c,
+                      ElemType *e);
+
+/**
+ *  @name        : Status InsertBefore_XDuL(XorList_DuL *L, XorCursor_DuL *c,
+ *ElemType e)
+ *	@description : insert a node holding e before the cursor, the cursor stays
+ *on the same node
+ *	@param		 : L, c(may be past the end to append), e
+ *	@return		 : Status(ERROR if out of memory)
+ *  @notice      : O(1)
+ */
+Status InsertBefore_XDuL(XorList_DuL *L, XorCursor_DuL *c, ElemType e);
+
+/**
+ *  @name        : Status InsertAfter_XDuL(XorList_DuL *L, XorCursor_DuL *c,
+ *ElemType e)
+ *	@description : insert a node holding e after the cursor, the cursor stays on
+ *the same node
+ *	@param		 : L, c, e
+ *	@return		 : Status(ERROR if past the end or out of memory)
+ *  @notice      : O(1)
+ */
+Status InsertAfter_XDuL(XorList_DuL *L, XorCursor_DuL *c, ElemType e);
+
+/**
+ *  @name        : Status DeleteAt_XDuL(XorList_DuL *L, XorCursor_DuL *c,
+ *ElemType *e)
+ *	@description : delete the node under the cursor and assign its value to e,
+ *the cursor moves to the next node
+ *	@param		 : L, c, e
+ *	@return		 : Status(ERROR if past the end)
+ *  @notice      : O(1), other cursors on the node or its neighbours become
+ *invalid
+ */
+Status DeleteAt_XDuL(XorList_DuL *L, XorCursor_DuL *c, ElemType *e);
+
+/**
+ *  @name        : void TraverseList_XDuL(XorList_DuL *L, void (*visit)(ElemType
+ *e))
+ *	@description : call visit on every value from the first node to the last
+ *	@param		 : L, visit
+ *	@return		 : void
+ *  @notice      : None
+ */
+void TraverseList_XDuL(XorList_DuL *L, void (*visit)(ElemType e));
+
+/**
+ *  @name        : void TraverseListBack_XDuL(XorList_DuL *L, void
+ *(*visit)(ElemType e))
+ *	@description : call visit on every value from the last node to the first
+ *	@param		 : L, visit
+ *	@return		 : void
+ *  @notice      : the same walk as TraverseList_XDuL started from the tail
+ */
+void TraverseListBack_XDuL(XorList_DuL *L, void (*visit)(ElemType e));
+
+/**************************************************************
+ *	End-Multi-Include-Prevent Section
+ **************************************************************/
+#endif
@@ -0,0 +1,170 @@
+/***************************************************************************************
+ *	File Name				:	lruCache.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision
+ *History-------------------------------------- No	version		Data
+ *Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+/**************************************************************
+ *	Multi-Include-Prevent Section
+ **************************************************************/
+
+#ifndef LRUCACHE_H_INCLUDED
+#define LRUCACHE_H_INCLUDED
+
+#include <stddef.h>
+#include "duLinkedList.h"
+
+/**************************************************************
+ *	Macro Define Section
+ **************************************************************/
+
+// smallest key table, must be a power of two
+#define LRU_CACHE_MIN_SLOTS 16
+
+/**************************************************************
+ *	Struct Define Section
+ **************************************************************/
+
+// define value type, a sensor reading
+typedef double LruValue;
+
+// define struct of cache entry, node comes first so that a DuLNode of the
+// recency list is the entry itself, node.data holds the key
+typedef struct LruEntry {
+  DuLNode node;
+  LruValue value;
+} LruEntry;
+
+// define struct of one slot of the key table, entry == NULL means empty
+typedef struct LruSlot {
+  ElemType key;
+  LruEntry *entry;
+} LruSlot;
+
+// define struct of cache statistics
+typedef struct LruStats {
+  unsigned long long hits;
+  unsigned long long misses;
+  unsigned long long insertions;
+  unsigned long long updates;
+  unsigned long long evictions;
+} LruStats;
+
+// define struct of fixed capacity LRU cache, recency is a circular sentinel
+// whose next is the most recently used entry and whose prior is the next one
+// to evict; entries and slots are allocated once by InitLruCache
+typedef struct LruCache {
+  DuLNode recency;
+  LruEntry *entries;
+  LruEntry *freeList;
+  size_t capacity;
+  size_t used;
+  size_t count;
+  LruSlot *slots;
+  size_t slotCount;
+  int shift;
+  LruStats stats;
+} LruCache;
+
+/**************************************************************
+ *	Prototype Declare Section
+ **************************************************************/
+
+/**
+ *  @name        : Status InitLruCache(LruCache *C, size_t capacity)
+ *	@description : allocate an empty cache holding at most capacity keys
+ *	@param		 : C, capacity(at least 1)
+ *	@return		 : Status(ERROR if capacity is 0 or out of memory)
+ *  @notice      : the only allocation of the cache; the sentinel lives inside
+ *C, so C must not be copied or moved
+ */
+Status InitLruCache(LruCache *C, size_t capacity);
+
+/**
+ *  @name        : void DestroyLruCache(LruCache *C)
+ *	@description : free the entries and the key table
+ *	@param		 : C
+ *	@return		 : void
+ *  @notice      : None
+ */
+void DestroyLruCache(LruCache *C);
+
+/**
+ *  @name        : Status Get_Lru(LruCache *C, ElemType key, LruValue *value)
+ *	@description : look key up, on a hit assign its value and make it the most
+ *recently used
+ *	@param		 : C, key, value
+ *	@return		 : Status(ERROR on a miss)
+ *  @notice      : O(1) expected, counts a hit or a miss
+ */
+Status Get_Lru(LruCache *C, ElemType key, LruValue *value);
+
+/**
+ *  @name        : Status Peek_Lru(const LruCache *C, ElemType key, LruValue
+ **value)
+ *	@description : same as Get_Lru, without touching recency or statistics
+ *	@param		 : C, key, value
+ *	@return		 : Status(ERROR if key is not cached)
+ *  @notice      : O(1) expected
+ */
+Status Peek_Lru(const LruCache *C, ElemType key, LruValue *value);
+
+/**
+ *  @name        : void Put_Lru(LruCache *C, ElemType key, LruValue value)
+ *	@description : insert or update key and make it the most recently used,
+ *evicting the least recently used key when the cache is full
+ *	@param		 : C, key, value
+ *	@return		 : void
+ *  @notice      : O(1) expected, never allocates
+ */
+void Put_Lru(LruCache *C, ElemType key, LruValue value);
+
+/**
+ *  @name        : Status Evict_Lru(LruCache *C, ElemType *key, LruValue *value)
+ *	@description : remove the least recently used key and assign it and its
+ *value to key and value
+ *	@param		 : C, key, value
+ *	@return		 : Status(ERROR if empty)
+ *  @notice      : O(1) expected, counted as an eviction
+ */
+Status Evict_Lru(LruCache *C, ElemType *key, LruValue *value);
+
+/**
+ *  @name        : size_t Size_Lru(const LruCache *C)
+ *	@description : number of cached keys
+ *	@param		 : C
+ *	@return		 : size
+ *  @notice      : None
+ */
+size_t Size_Lru(const LruCache *C);
+
+/**
+ *  @name        : void GetStats_Lru(const LruCache *C, LruStats *stats)
+ *	@description : copy the hit, miss, insertion, update and eviction counts
+ *	@param		 : C, stats
+ *	@return		 : void
+ *  @notice      : None
+ */
+void GetStats_Lru(const LruCache *C, LruStats *stats);
+
+/**
+ *  @name        : void ResetStats_Lru(LruCache *C)
+ *	@description : set every count to zero, the cached keys are kept
+ *	@param		 : C
+ *	@return		 : void
+ *  @notice      : None
+ */
+void ResetStats_Lru(LruCache *C);
+
+/**************************************************************
+ *	End-Multi-Include-Prevent Section
+ **************************************************************/
+#endif
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "duCircularList.h"
+#include "containerStats.h"
+
+Status InitList_CDuL(CircularList_DuL *L) {
+    // 哨兵节点的前后指针都指向自己
+    *L = (CircularList_DuL)malloc(sizeof(DuLNode));
+    if (*L == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+
+    (*L)->prior = *L;
+    (*L)->next = *L;
+    STATS_ALLOC(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
+    return SUCCESS;
+}
+
+void DestroyList_CDuL(CircularList_DuL *L) {
+    DuLNode *current, *temp;
+    STATS_COUNTER(freed);
+
+    if (*L == NULL) {
+        return;
+    }
+
+    // 绕一圈回到哨兵为止，最后释放哨兵
+    current = (*L)->next;
+    while (current != *L) {
+        temp = current;
+        current = current->next;
+        free(temp);
+        STATS_STEP(freed);
+    }
+    free(*L);
+    STATS_FREE(STATS_DU_LINKED_LIST, freed + 1, (freed + 1) * sizeof(DuLNode));
+    *L = NULL;
+}
+
+int IsEmpty_CDuL(CircularList_DuL L) {
+    return L->next == L;
+}
+
+void InsertBefore_CDuL(DuLNode *p, DuLNode *q) {
+    // 环上每个节点都有前驱，不需要判空
+    q->prior = p->prior;
+    q->next = p;
+    p->prior->next = q;
+    p->prior = q;
+    STATS_ALLOC(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
+}
+
+void InsertAfter_CDuL(DuLNode *p, DuLNode *q) {
+    q->prior = p;
+    q->next = p->next;
+    p->next->prior = q;
+    p->next = q;
+    STATS_ALLOC(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
+}
+
+void Unlink_CDuL(DuLNode *p) {
+    p->prior->next = p->next;
+    p->next->prior = p->prior;
+    p->prior = p;
+    p->next = p;
+
+    // 节点交还调用者，之后不再由链表释放
+    STATS_FREE(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
+}
+
+Status PushFront_CDuL(CircularList_DuL L, ElemType e) {
+    DuLNode *node = (DuLNode *)malloc(sizeof(DuLNode));
+    if (node == NULL) {
+        return ERROR;
+    }
+
+    node->data = e;
+    InsertAfter_CDuL(L, node);
+    return SUCCESS;
+}
+
+Status PushBack_CDuL(CircularList_DuL L, ElemType e) {
+    DuLNode *node = (DuLNode *)malloc(sizeof(DuLNode));
+    if (node == NULL) {
+        return ERROR;
+    }
+
+    // 插在哨兵之前即为表尾
+    node->data = e;
+    InsertBefore_CDuL(L, node);
+    return SUCCESS;
+}
+
+Status PopFront_CDuL(CircularList_DuL L, ElemType *e) {
+    DuLNode *node = L->next;
+
+    if (node == L) {
+        return ERROR;  // 空表
+    }
+
+    *e = node->data;
+    Unlink_CDuL(node);
+    free(node);
+    return SUCCESS;
+}
+
+Status PopBack_CDuL(CircularList_DuL L, ElemType *e) {
+    DuLNode *node = L->prior;
+
+    if (node == L) {
+        return ERROR;  // 空表
+    }
+
+    *e = node->data;
+    Unlink_CDuL(node);
+    free(node);
+    return SUCCESS;
+}
+
+void Splice_CDuL(DuLNode *pos, DuLNode *first, DuLNode *last) {
+    DuLNode *before = first->prior;
+    DuLNode *after = last->next;
+
+    // 从原表摘下整段，两端直接相连
+    before->next = after;
+    after->prior = before;
+
+    // 整段接到pos之前
+    first->prior = pos->prior;
+    last->next = pos;
+    pos->prior->next = first;
+    pos->prior = last;
+}
+
+void Concat_CDuL(CircularList_DuL L, CircularList_DuL other) {
+    if (other->next == other) {
+        return;  // other为空
+    }
+    Splice_CDuL(L, other->next, other->prior);
+}
+
+void Split_CDuL(CircularList_DuL L, DuLNode *p, CircularList_DuL tail) {
+    // p到表尾这一段的末端就是哨兵的前驱
+    Splice_CDuL(tail, p, L->prior);
+}
+
+void TraverseList_CDuL(CircularList_DuL L, void (*visit)(ElemType e)) {
+    DuLNode *current = L->next;  // 从第一个实际节点开始
+    STATS_COUNTER(visited);
+
+    // 回到哨兵即走完一圈
+    while (current != L) {
+        visit(current->data);
+        current = current->next;
+        STATS_STEP(visited);
+    }
+    STATS_VISIT(STATS_DU_LINKED_LIST, visited);
+}
@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "duCompactList.h"
+
+double ListFragmentation_DuL(DuLinkedList L) {
+    size_t links = 0, jumps = 0;
+    DuLNode *current;
+
+    if (L == NULL || L->next == NULL) {
+        return 0.0;  // 空链表
+    }
+
+    // 统计向后跳或向前跳出一个缓存行的次数，malloc在节点之间留的头部不算
+    for (current = L; current->next != NULL; current = current->next) {
+        uintptr_t from = (uintptr_t)current, to = (uintptr_t)current->next;
+        links++;
+        if (to < from || to - from > DU_COMPACT_NEAR_BYTES) {
+            jumps++;
+        }
+    }
+
+    return (double)jumps / (double)links;
+}
+
+Status CompactList_DuL(DuNodePool *pool, DuLinkedList *L) {
+    DuNodePool fresh;
+    DuLNode *current, *tail, *head;
+    size_t n = 0;
+
+    if (pool == NULL || L == NULL || *L == NULL) {
+        return ERROR;
+    }
+
+    // 统计节点数（含头节点），新池的第一块恰好放下整条链表
+    for (current = *L; current != NULL; current = current->next) {
+        n++;
+    }
+    InitDuNodePool(&fresh, n);
+
+    head = AllocNode_DuL(&fresh, (*L)->data);
+    if (head == NULL) {
+        return ERROR;  // 内存分配失败，原链表保持不变
+    }
+    tail = head;
+
+    // 按链表顺序依次复制，同时接好prior
+    for (current = (*L)->next; current != NULL; current = current->next) {
+        DuLNode *node = AllocNode_DuL(&fresh, current->data);
+        if (node == NULL) {
+            DestroyDuNodePool(&fresh);
+            return ERROR;  // 内存分配失败，原链表保持不变
+        }
+        node->prior = tail;
+        tail->next = node;
+        tail = node;
+    }
+
+    // 释放旧节点
+    if (pool->slabs == NULL) {
+        DestroyList_DuL(L);
+    } else {
+        DestroyDuNodePool(pool);
+    }
+
+    fresh.slabNodes = pool->slabNodes != 0 ? pool->slabNodes : DU_NODE_POOL_DEFAULT_SLAB;
+    *pool = fresh;
+    *L = head;
+    return SUCCESS;
+}
+
+void InitCompactPolicy_DuL(DuCompactPolicy *policy, double threshold, unsigned long interval) {
+    policy->threshold = threshold;
+    policy->interval = interval;
+    policy->pending = 0;
+    policy->compactions = 0;
+}
+
+Status NoteListMutation_DuL(DuCompactPolicy *policy, DuNodePool *pool, DuLinkedList *L) {
+    // 每interval次修改才测量一次
+    if (++policy->pending < policy->interval) {
+        return SUCCESS;
+    }
+    policy->pending = 0;
+
+    if (ListFragmentation_DuL(*L) <= policy->threshold) {
+        return SUCCESS;
+    }
+
+    if (CompactList_DuL(pool, L) == ERROR) {
+        return ERROR;
+    }
+    policy->compactions++;
+    return SUCCESS;
+}
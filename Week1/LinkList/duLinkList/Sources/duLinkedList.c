@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "duLinkedList.h"
+#include "containerStats.h"
 
 Status InitList_DuL(DuLinkedList *L) {
     // 分配头节点内存
@@ -13,18 +14,22 @@ Status InitList_DuL(DuLinkedList *L) {
     // 初始化头节点
     (*L)->prior = NULL;
     (*L)->next = NULL;
+    STATS_ALLOC(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
     return SUCCESS;
 }
 
 void DestroyList_DuL(DuLinkedList *L) {
     DuLinkedList temp;
+    STATS_COUNTER(freed);
     
     // 循环释放所有节点内存
     while (*L != NULL) {
         temp = *L;  // 保存当前节点
         *L = (*L)->next;  // 移动到下一个节点
         free(temp);  // 释放当前节点内存
+        STATS_STEP(freed);
     }
+    STATS_FREE(STATS_DU_LINKED_LIST, freed, freed * sizeof(DuLNode));
 }
 
 Status InsertBeforeList_DuL(DuLNode *p, DuLNode *q) {
@@ -44,6 +49,8 @@ Status InsertBeforeList_DuL(DuLNode *p, DuLNode *q) {
     // 更新p的prior指针
     p->prior = q;
     
+    // 调用者分配的节点插入后归链表所有，由链表负责释放
+    STATS_ALLOC(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
     return SUCCESS;
 }
 
@@ -64,6 +71,7 @@ Status InsertAfterList_DuL(DuLNode *p, DuLNode *q) {
     // 更新p的next指针
     p->next = q;
     
+    STATS_ALLOC(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
     return SUCCESS;
 }
 
@@ -82,15 +90,47 @@ Status DeleteList_DuL(DuLNode *p, ElemType *e) {
     }
     
     free(q);  // 释放节点内存
+    STATS_FREE(STATS_DU_LINKED_LIST, 1, sizeof(DuLNode));
     return SUCCESS;
 }
 
 void TraverseList_DuL(DuLinkedList L, void (*visit)(ElemType e)) {
     DuLNode *current = L->next;  // 从第一个实际节点开始
+    STATS_COUNTER(visited);
     
     // 遍历所有节点
     while (current != NULL) {
         visit(current->data);  // 访问节点数据
         current = current->next;  // 移动到下一个节点
+        STATS_STEP(visited);
     }
+    STATS_VISIT(STATS_DU_LINKED_LIST, visited);
+}
+
+void TraverseListBatch_DuL(DuLinkedList L, ElemType *buffer, int size, void (*visit)(const ElemType *block, int n)) {
+    DuLNode *current = L->next;  // 从第一个实际节点开始
+    int n = 0;
+    STATS_COUNTER(visited);
+
+    if (buffer == NULL || size <= 0) {
+        return;
+    }
+
+    // 逐个拷贝到缓冲区，visit按块调用而不是每个节点调用一次
+    while (current != NULL) {
+        buffer[n++] = current->data;
+        current = current->next;
+        STATS_STEP(visited);
+
+        // 缓冲区满了整块交给visit
+        if (n == size) {
+            visit(buffer, n);
+            n = 0;
+        }
+    }
+
+    if (n > 0) {
+        visit(buffer, n);
+    }
+    STATS_VISIT(STATS_DU_LINKED_LIST, visited);
 }
\ No newline at end of file
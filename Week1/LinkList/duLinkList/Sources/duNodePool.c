@@ -0,0 +1,103 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "duNodePool.h"
+
+Status InitDuNodePool(DuNodePool *pool, size_t slabNodes) {
+    if (pool == NULL) {
+        return ERROR;
+    }
+
+    pool->slabs = NULL;
+    pool->freeList = NULL;
+    pool->slabNodes = slabNodes == 0 ? DU_NODE_POOL_DEFAULT_SLAB : slabNodes;
+    pool->bump = 0;
+    pool->live = 0;
+    return SUCCESS;
+}
+
+void DestroyDuNodePool(DuNodePool *pool) {
+    DuNodeSlab *temp;
+
+    // 逐块释放
+    while (pool->slabs != NULL) {
+        temp = pool->slabs;
+        pool->slabs = pool->slabs->next;
+        free(temp);
+    }
+
+    pool->freeList = NULL;
+    pool->bump = 0;
+    pool->live = 0;
+}
+
+DuLNode *AllocNode_DuL(DuNodePool *pool, ElemType e) {
+    DuLNode *node;
+
+    if (pool->freeList != NULL) {
+        // 优先复用空闲链表中的节点
+        node = pool->freeList;
+        pool->freeList = node->next;
+    } else {
+        // 当前块用完时再申请一整块
+        if (pool->slabs == NULL || pool->bump == pool->slabs->capacity) {
+            DuNodeSlab *slab = (DuNodeSlab *)malloc(sizeof(DuNodeSlab) + pool->slabNodes * sizeof(DuLNode));
+            if (slab == NULL) {
+                return NULL;  // 内存分配失败
+            }
+            slab->capacity = pool->slabNodes;
+            slab->next = pool->slabs;
+            pool->slabs = slab;
+            pool->bump = 0;
+        }
+        node = &pool->slabs->nodes[pool->bump++];
+    }
+
+    node->data = e;
+    node->prior = NULL;
+    node->next = NULL;
+    pool->live++;
+    return node;
+}
+
+void FreeNode_DuL(DuNodePool *pool, DuLNode *node) {
+    if (node == NULL) {
+        return;
+    }
+
+    // 挂到空闲链表头部，只使用next
+    node->prior = NULL;
+    node->next = pool->freeList;
+    pool->freeList = node;
+    pool->live--;
+}
+
+Status InsertListPool_DuL(DuNodePool *pool, DuLNode *p, ElemType e) {
+    DuLNode *q;
+
+    if (p == NULL) {
+        return ERROR;
+    }
+    q = AllocNode_DuL(pool, e);
+    if (q == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+    return InsertAfterList_DuL(p, q);
+}
+
+Status DeleteListPool_DuL(DuNodePool *pool, DuLNode *p, ElemType *e) {
+    if (p == NULL || p->next == NULL) {
+        return ERROR;  // p为空或p是最后一个节点
+    }
+
+    DuLNode *q = p->next;  // 要删除的节点
+    *e = q->data;  // 保存节点数据
+
+    // 更新指针
+    p->next = q->next;
+    if (q->next != NULL) {
+        q->next->prior = p;
+    }
+
+    FreeNode_DuL(pool, q);  // 节点归还给内存池
+    return SUCCESS;
+}
@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "duXorList.h"
+#include "containerStats.h"
+
+#define XOR_PTR(a, b) ((XorNode *)((uintptr_t)(a) ^ (uintptr_t)(b)))
+
+/**
+ * @brief Take a node from the free list or the current slab
+ */
+static XorNode *allocNode(XorList_DuL *L, ElemType e) {
+    XorNode *node;
+
+    if (L->freeList != NULL) {
+        // 空闲节点通过link串起来
+        node = L->freeList;
+        L->freeList = (XorNode *)node->link;
+    } else {
+        if (L->slabs == NULL || L->bump == L->slabs->capacity) {
+            XorNodeSlab *slab = (XorNodeSlab *)malloc(sizeof(XorNodeSlab) + L->slabNodes * sizeof(XorNode));
+            if (slab == NULL) {
+                return NULL;  // 内存分配失败
+            }
+            slab->capacity = L->slabNodes;
+            slab->next = L->slabs;
+            L->slabs = slab;
+            L->bump = 0;
+        }
+        node = &L->slabs->nodes[L->bump++];
+    }
+
+    node->data = e;
+    STATS_ALLOC(STATS_DU_LINKED_LIST, 1, sizeof(XorNode));
+    return node;
+}
+
+static void freeNode(XorList_DuL *L, XorNode *node) {
+    node->link = (uintptr_t)L->freeList;
+    L->freeList = node;
+    STATS_FREE(STATS_DU_LINKED_LIST, 1, sizeof(XorNode));
+}
+
+/**
+ * @brief Link a new node between two adjacent nodes a and b
+ */
+static void linkBetween(XorNode *a, XorNode *q, XorNode *b) {
+    q->link = (uintptr_t)a ^ (uintptr_t)b;
+    // a的邻居由b换成q，b的邻居由a换成q
+    a->link ^= (uintptr_t)b ^ (uintptr_t)q;
+    b->link ^= (uintptr_t)a ^ (uintptr_t)q;
+}
+
+Status InitList_XDuL(XorList_DuL *L, size_t slabNodes) {
+    if (L == NULL) {
+        return ERROR;
+    }
+
+    // 头哨兵的另一侧是NULL，所以link就是第一个节点，尾哨兵同理
+    L->head.data = 0;
+    L->head.link = (uintptr_t)&L->tail;
+    L->tail.data = 0;
+    L->tail.link = (uintptr_t)&L->head;
+    L->slabs = NULL;
+    L->freeList = NULL;
+    L->slabNodes = slabNodes == 0 ? XOR_LIST_DEFAULT_SLAB : slabNodes;
+    L->bump = 0;
+    L->length = 0;
+    return SUCCESS;
+}
+
+void DestroyList_XDuL(XorList_DuL *L) {
+    XorNodeSlab *temp;
+
+    STATS_FREE(STATS_DU_LINKED_LIST, L->length, L->length * sizeof(XorNode));
+
+    // 节点都在块里，逐块释放即可
+    while (L->slabs != NULL) {
+        temp = L->slabs;
+        L->slabs = L->slabs->next;
+        free(temp);
+    }
+
+    L->head.link = (uintptr_t)&L->tail;
+    L->tail.link = (uintptr_t)&L->head;
+    L->freeList = NULL;
+    L->bump = 0;
+    L->length = 0;
+}
+
+size_t ListLength_XDuL(const XorList_DuL *L) {
+    return L->length;
+}
+
+void CursorFront_XDuL(XorList_DuL *L, XorCursor_DuL *c) {
+    c->prev = &L->head;
+    c->cur = (XorNode *)L->head.link;
+}
+
+void CursorEnd_XDuL(XorList_DuL *L, XorCursor_DuL *c) {
+    c->prev = (XorNode *)L->tail.link;
+    c->cur = &L->tail;
+}
+
+int CursorAtEnd_XDuL(const XorList_DuL *L, const XorCursor_DuL *c) {
+    return c->cur == &L->tail;
+}
+
+Status CursorNext_XDuL(XorList_DuL *L, XorCursor_DuL *c) {
+    XorNode *next;
+
+    if (c->cur == &L->tail) {
+        return ERROR;
+    }
+
+    // 已知前驱，异或即得后继
+    next = XOR_PTR(c->cur->link, c->prev);
+    c->prev = c->cur;
+    c->cur = next;
+    return SUCCESS;
+}
+
+Status CursorPrev_XDuL(XorList_DuL *L, XorCursor_DuL *c) {
+    XorNode *before;
+
+    if (c->prev == &L->head) {
+        return ERROR;
+    }
+
+    before = XOR_PTR(c->prev->link, c->cur);
+    c->cur = c->prev;
+    c->prev = before;
+    return SUCCESS;
+}
+
+Status CursorGet_XDuL(const XorList_DuL *L, const XorCursor_DuL *c, ElemType *e) {
+    if (c->cur == &L->tail) {
+        return ERROR;
+    }
+
+    *e = c->cur->data;
+    return SUCCESS;
+}
+
+Status InsertBefore_XDuL(XorList_DuL *L, XorCursor_DuL *c, ElemType e) {
+    XorNode *q = allocNode(L, e);
+    if (q == NULL) {
+        return ERROR;
+    }
+
+    linkBetween(c->prev, q, c->cur);
+    c->prev = q;  // 新节点成为游标的前驱
+    L->length++;
+    return SUCCESS;
+}
+
+Status InsertAfter_XDuL(XorList_DuL *L, XorCursor_DuL *c, ElemType e) {
+    XorNode *next, *q;
+
+    if (c->cur == &L->tail) {
+        return ERROR;
+    }
+    q = allocNode(L, e);
+    if (q == NULL) {
+        return ERROR;
+    }
+
+    next = XOR_PTR(c->cur->link, c->prev);
+    linkBetween(c->cur, q, next);
+    L->length++;
+    return SUCCESS;
+}
+
+Status DeleteAt_XDuL(XorList_DuL *L, XorCursor_DuL *c, ElemType *e) {
+    XorNode *q = c->cur, *next;
+
+    if (q == &L->tail) {
+        return ERROR;
+    }
+
+    *e = q->data;
+    next = XOR_PTR(q->link, c->prev);
+
+    // 前驱和后继的邻居都由q换成对方
+    c->prev->link ^= (uintptr_t)q ^ (uintptr_t)next;
+    next->link ^= (uintptr_t)q ^ (uintptr_t)c->prev;
+    c->cur = next;
+
+    freeNode(L, q);
+    L->length--;
+    return SUCCESS;
+}
+
+/**
+ * @brief Walk from one sentinel to the other, both directions are the same walk
+ */
+static void walk(XorNode *from, XorNode *to, void (*visit)(ElemType e)) {
+    XorNode *prev = from, *current = (XorNode *)from->link, *next;
+    STATS_COUNTER(visited);
+
+    while (current != to) {
+        visit(current->data);
+        next = XOR_PTR(current->link, prev);
+        prev = current;
+        current = next;
+        STATS_STEP(visited);
+    }
+    STATS_VISIT(STATS_DU_LINKED_LIST, visited);
+}
+
+void TraverseList_XDuL(XorList_DuL *L, void (*visit)(ElemType e)) {
+    walk(&L->head, &L->tail, visit);
+}
+
+void TraverseListBack_XDuL(XorList_DuL *L, void (*visit)(ElemType e)) {
+    walk(&L->tail, &L->head, visit);
+}
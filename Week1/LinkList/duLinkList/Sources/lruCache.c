@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "lruCache.h"
+#include "duCircularList.h"
+#include "containerStats.h"
+
+/**
+ *  @name        : static size_t Home_Lru(const LruCache *C, ElemType key)
+ *	@description : home slot of key, fibonacci hashing keeps the high bits
+ */
+static size_t Home_Lru(const LruCache *C, ElemType key) {
+    return (size_t)(((uint32_t)key * 2654435769u) >> C->shift);
+}
+
+/**
+ *  @name        : static LruSlot* Find_Lru(const LruCache *C, ElemType key)
+ *	@description : find the slot of key, NULL if key is not cached
+ */
+static LruSlot* Find_Lru(const LruCache *C, ElemType key) {
+    size_t mask = C->slotCount - 1;
+    size_t i = Home_Lru(C, key);
+
+    while (C->slots[i].entry != NULL) {
+        if (C->slots[i].key == key) {
+            return &C->slots[i];
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+/**
+ *  @name        : static void Place_Lru(LruCache *C, LruEntry *entry)
+ *	@description : put an entry into the first free slot of its probe sequence, the table never fills
+ */
+static void Place_Lru(LruCache *C, LruEntry *entry) {
+    size_t mask = C->slotCount - 1;
+    size_t i = Home_Lru(C, entry->node.data);
+
+    while (C->slots[i].entry != NULL) {
+        i = (i + 1) & mask;
+    }
+    C->slots[i].key = entry->node.data;
+    C->slots[i].entry = entry;
+}
+
+/**
+ *  @name        : static void Remove_Lru(LruCache *C, LruSlot *slot)
+ *	@description : empty a slot and shift the following entries back, so no tombstones are needed
+ */
+static void Remove_Lru(LruCache *C, LruSlot *slot) {
+    size_t mask = C->slotCount - 1;
+    size_t i = (size_t)(slot - C->slots);
+    size_t j = i;
+
+    for (;;) {
+        j = (j + 1) & mask;
+        if (C->slots[j].entry == NULL) {
+            break;
+        }
+
+        // j的元素只有在其起始位置不落在(i, j]区间时才能前移到i
+        size_t k = Home_Lru(C, C->slots[j].key);
+        if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+            C->slots[i] = C->slots[j];
+            i = j;
+        }
+    }
+
+    C->slots[i].entry = NULL;
+}
+
+/**
+ *  @name        : static void Touch_Lru(LruCache *C, LruEntry *entry)
+ *	@description : make a cached entry the most recently used
+ */
+static void Touch_Lru(LruCache *C, LruEntry *entry) {
+    // 已在表头时不动，Splice不允许把节点接到自己前面
+    if (C->recency.next != &entry->node) {
+        Splice_CDuL(C->recency.next, &entry->node, &entry->node);
+    }
+}
+
+Status InitLruCache(LruCache *C, size_t capacity) {
+    size_t slotCount = LRU_CACHE_MIN_SLOTS;
+    int bits = 0;
+
+    if (C == NULL || capacity == 0) {
+        return ERROR;
+    }
+
+    // 装载因子不超过1/2
+    while (slotCount < 2 * capacity) {
+        slotCount *= 2;
+    }
+    while (((size_t)1 << bits) < slotCount) {
+        bits++;
+    }
+
+    C->entries = (LruEntry *)malloc(capacity * sizeof(LruEntry));
+    C->slots = (LruSlot *)calloc(slotCount, sizeof(LruSlot));
+    if (C->entries == NULL || C->slots == NULL) {
+        free(C->entries);
+        free(C->slots);
+        C->entries = NULL;
+        C->slots = NULL;
+        return ERROR;  // 内存分配失败
+    }
+
+    C->recency.data = 0;
+    C->recency.prior = &C->recency;
+    C->recency.next = &C->recency;
+    C->freeList = NULL;
+    C->capacity = capacity;
+    C->used = 0;
+    C->count = 0;
+    C->slotCount = slotCount;
+    C->shift = 32 - bits;
+    ResetStats_Lru(C);
+    return SUCCESS;
+}
+
+void DestroyLruCache(LruCache *C) {
+    // 条目不是逐个分配的，直接丢弃整条链
+    STATS_FREE(STATS_DU_LINKED_LIST, C->count, C->count * sizeof(DuLNode));
+    free(C->entries);
+    free(C->slots);
+    C->entries = NULL;
+    C->slots = NULL;
+    C->freeList = NULL;
+    C->recency.prior = &C->recency;
+    C->recency.next = &C->recency;
+    C->capacity = 0;
+    C->used = 0;
+    C->count = 0;
+    C->slotCount = 0;
+}
+
+Status Get_Lru(LruCache *C, ElemType key, LruValue *value) {
+    LruSlot *slot = Find_Lru(C, key);
+
+    if (slot == NULL) {
+        C->stats.misses++;
+        return ERROR;
+    }
+
+    *value = slot->entry->value;
+    Touch_Lru(C, slot->entry);
+    C->stats.hits++;
+    return SUCCESS;
+}
+
+Status Peek_Lru(const LruCache *C, ElemType key, LruValue *value) {
+    LruSlot *slot = Find_Lru(C, key);
+
+    if (slot == NULL) {
+        return ERROR;
+    }
+
+    *value = slot->entry->value;
+    return SUCCESS;
+}
+
+void Put_Lru(LruCache *C, ElemType key, LruValue value) {
+    LruSlot *slot = Find_Lru(C, key);
+    LruEntry *entry;
+
+    if (slot != NULL) {
+        slot->entry->value = value;
+        Touch_Lru(C, slot->entry);
+        C->stats.updates++;
+        return;
+    }
+
+    if (C->count == C->capacity) {
+        // 已满时直接复用最久未用的条目，链表里只需把它移到表头
+        entry = (LruEntry *)C->recency.prior;
+        Remove_Lru(C, Find_Lru(C, entry->node.data));
+        entry->node.data = key;
+        entry->value = value;
+        Place_Lru(C, entry);
+        Touch_Lru(C, entry);
+        C->stats.evictions++;
+        C->stats.insertions++;
+        return;
+    }
+
+    // 先用回收的条目，再用从未使用过的条目
+    if (C->freeList != NULL) {
+        entry = C->freeList;
+        C->freeList = (LruEntry *)entry->node.next;
+    } else {
+        entry = &C->entries[C->used++];
+    }
+
+    entry->node.data = key;
+    entry->value = value;
+    InsertAfter_CDuL(&C->recency, &entry->node);
+    Place_Lru(C, entry);
+    C->count++;
+    C->stats.insertions++;
+}
+
+Status Evict_Lru(LruCache *C, ElemType *key, LruValue *value) {
+    LruEntry *entry;
+
+    if (C->count == 0) {
+        return ERROR;
+    }
+
+    entry = (LruEntry *)C->recency.prior;
+    *key = entry->node.data;
+    *value = entry->value;
+    Remove_Lru(C, Find_Lru(C, entry->node.data));
+    Unlink_CDuL(&entry->node);
+
+    // 条目挂到空闲链表，只使用next
+    entry->node.next = (DuLNode *)C->freeList;
+    C->freeList = entry;
+    C->count--;
+    C->stats.evictions++;
+    return SUCCESS;
+}
+
+size_t Size_Lru(const LruCache *C) {
+    return C->count;
+}
+
+void GetStats_Lru(const LruCache *C, LruStats *stats) {
+    *stats = C->stats;
+}
+
+void ResetStats_Lru(LruCache *C) {
+    C->stats.hits = 0;
+    C->stats.misses = 0;
+    C->stats.insertions = 0;
+    C->stats.updates = 0;
+    C->stats.evictions = 0;
+}
@@ -0,0 +1,198 @@
+/**
+ * @file duCompactListTest.c
+ * @brief ListFragmentation_DuL and the relayout policy on DuLNode lists
+ * @note Usage: duCompactListTest
+ *       Same checks as compactListTest for the doubly linked list: a list built in order scores
+ *       below the policy threshold, a shuffled one above it, and a malloc'd list compacted into a
+ *       pool and edited through InsertListPool_DuL/DeleteListPool_DuL keeps its values and its
+ *       prior links. Exits 1 on the first failed check.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "duLinkedList.h"
+#include "duNodePool.h"
+#include "duCompactList.h"
+
+#define NODES 20000
+#define EDIT_NODES 2000
+#define EDITS 100000
+#define THRESHOLD 0.5
+
+static unsigned long long rngState = 0x9E3779B97F4A7C15ull;
+
+/**
+ * @brief xorshift64, uniform in [0, bound)
+ */
+static size_t nextRandom(size_t bound) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (size_t)(rngState % bound);
+}
+
+static int check(int ok, const char *what) {
+    if (!ok) {
+        fprintf(stderr, "failed: %s\n", what);
+    }
+    return ok;
+}
+
+/**
+ * @brief Compare the list with the expected values, every prior must point back
+ */
+static int sameAs(DuLinkedList L, const ElemType *expected, size_t n) {
+    DuLNode *p = L;
+
+    for (size_t i = 0; i < n; i++) {
+        if (p->next == NULL || p->next->prior != p || p->next->data != expected[i]) {
+            return 0;
+        }
+        p = p->next;
+    }
+    return p->next == NULL;
+}
+
+/**
+ * @brief Relink the nodes after the head in a random order
+ */
+static void shuffleLinks(DuLinkedList L, size_t n) {
+    DuLNode **nodes = (DuLNode **)malloc(n * sizeof(DuLNode *));
+    DuLNode *p = L->next;
+
+    for (size_t i = 0; i < n; i++, p = p->next) {
+        nodes[i] = p;
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = nextRandom(i + 1);
+        DuLNode *temp = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = temp;
+    }
+    L->next = nodes[0];
+    nodes[0]->prior = L;
+    for (size_t i = 0; i + 1 < n; i++) {
+        nodes[i]->next = nodes[i + 1];
+        nodes[i + 1]->prior = nodes[i];
+    }
+    nodes[n - 1]->next = NULL;
+    free(nodes);
+}
+
+int main(void) {
+    ElemType *expected = (ElemType *)malloc(NODES * sizeof(ElemType));
+    DuCompactPolicy policy;
+    DuNodePool pool;
+    DuLinkedList L;
+    DuLNode *tail;
+    size_t n;
+    double f;
+
+    // malloc'd nodes appended in order sit one malloc header apart
+    InitList_DuL(&L);
+    tail = L;
+    for (size_t i = 0; i < NODES; i++) {
+        DuLNode *q = (DuLNode *)malloc(sizeof(DuLNode));
+        q->data = (ElemType)i;
+        InsertAfterList_DuL(tail, q);
+        tail = q;
+    }
+    f = ListFragmentation_DuL(L);
+    printf("sequential malloc list: %.3f\n", f);
+    if (!check(f < THRESHOLD, "a list built in order scores below the threshold")) {
+        return 1;
+    }
+
+    shuffleLinks(L, NODES);
+    f = ListFragmentation_DuL(L);
+    printf("shuffled malloc list:   %.3f\n", f);
+    if (!check(f > THRESHOLD, "a shuffled list scores above the threshold")) {
+        return 1;
+    }
+
+    // Hand the shuffled malloc'd list to an empty pool, its order must survive
+    n = 0;
+    for (DuLNode *p = L->next; p != NULL; p = p->next) {
+        expected[n++] = p->data;
+    }
+    InitDuNodePool(&pool, 0);
+    if (!check(CompactList_DuL(&pool, &L) == SUCCESS, "CompactList_DuL on a malloc'd list") ||
+        !check(sameAs(L, expected, NODES), "compaction keeps the order") ||
+        !check(ListFragmentation_DuL(L) == 0.0, "a compacted list scores 0")) {
+        return 1;
+    }
+    DestroyDuNodePool(&pool);
+
+    // Appending in order to a pool list never triggers a relayout
+    InitDuNodePool(&pool, 0);
+    L = AllocNode_DuL(&pool, 0);
+    L->prior = L->next = NULL;
+    tail = L;
+    InitCompactPolicy_DuL(&policy, THRESHOLD, 0);
+    for (size_t i = 0; i < NODES; i++) {
+        InsertListPool_DuL(&pool, tail, (ElemType)i);
+        tail = tail->next;
+        NoteListMutation_DuL(&policy, &pool, &L);
+    }
+    printf("sequential pool list:   %.3f, %lu relayouts\n", ListFragmentation_DuL(L),
+           policy.compactions);
+    if (!check(policy.compactions == 0, "appending in order does not relayout")) {
+        return 1;
+    }
+    DestroyDuNodePool(&pool);
+
+    // Random edits through the pool functions, the policy relays the list out as it scatters
+    InitDuNodePool(&pool, 64);
+    L = AllocNode_DuL(&pool, 0);
+    L->prior = L->next = NULL;
+    tail = L;
+    InitCompactPolicy_DuL(&policy, THRESHOLD, 256);
+    n = 0;
+    for (size_t i = 0; i < EDIT_NODES; i++) {
+        InsertListPool_DuL(&pool, tail, (ElemType)i);
+        tail = tail->next;
+        expected[n++] = (ElemType)i;
+    }
+    for (long k = 0; k < EDITS; k++) {
+        int insert = n == 0 || (n < NODES && nextRandom(2) == 0);
+        size_t at = insert ? nextRandom(n + 1) : nextRandom(n);
+        DuLNode *p = L;
+        ElemType e;
+
+        for (size_t i = 0; i < at; i++) {
+            p = p->next;
+        }
+        if (insert) {
+            InsertListPool_DuL(&pool, p, (ElemType)k);
+            for (size_t i = n; i > at; i--) {
+                expected[i] = expected[i - 1];
+            }
+            expected[at] = (ElemType)k;
+            n++;
+        } else {
+            DeleteListPool_DuL(&pool, p, &e);
+            for (size_t i = at; i + 1 < n; i++) {
+                expected[i] = expected[i + 1];
+            }
+            n--;
+        }
+        unsigned long before = policy.compactions;
+        if (!check(NoteListMutation_DuL(&policy, &pool, &L) == SUCCESS, "NoteListMutation_DuL")) {
+            return 1;
+        }
+        if (policy.compactions != before &&
+            !check(sameAs(L, expected, n) && pool.live == n + 1, "a relayout keeps every value")) {
+            return 1;
+        }
+    }
+    printf("random edits:           %.3f, %lu relayouts\n", ListFragmentation_DuL(L),
+           policy.compactions);
+    if (!check(policy.compactions > 0, "random edits trigger a relayout") ||
+        !check(sameAs(L, expected, n), "the edited list matches")) {
+        return 1;
+    }
+    DestroyDuNodePool(&pool);
+
+    free(expected);
+    return 0;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file concurrentListBench.c
+ * @brief Stress check and throughput scaling of the lock-free ConcurrentList
+ * @note Usage: concurrentListBench [maxThreads] [opsPerThread] [keyRange]
+ *       The stress phase gives every thread its own residue class of keys, replays
+ *       random inserts/deletes against a private expected set and checks the final
+ *       list against the union of those sets. The throughput phase runs a mixed
+ *       workload (10% insert, 10% delete, 80% search) for 1..maxThreads threads and
+ *       compares it with a LinkedList behind one pthread mutex.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "linkedList.h"
+#include "concurrentList.h"
+
+#define DEFAULT_OPS 200000L
+#define DEFAULT_KEYS 1024
+
+typedef struct {
+    ConcurrentList *list;
+    LinkedList locked;
+    pthread_mutex_t *lock;
+    int id;
+    int threads;
+    long ops;
+    int keys;
+    unsigned char *expected;   /**< stress phase: 1 if key is expected in the list */
+} Worker;
+
+static ElemType lastSeen;
+static long seenCount;
+static int sortedOk;
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief xorshift32, one state per thread
+ */
+static unsigned nextRandom(unsigned *state) {
+    unsigned x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *state = x;
+}
+
+static void checkSorted(ElemType e) {
+    if (seenCount > 0 && e <= lastSeen) {
+        sortedOk = 0;
+    }
+    lastSeen = e;
+    seenCount++;
+}
+
+static void *stressWorker(void *arg) {
+    Worker *w = (Worker *)arg;
+    EpochRecord *r = RegisterThread_Conc(w->list);
+    unsigned seed = 0x9e3779b9u * (unsigned)(w->id + 1);
+
+    for (long i = 0; i < w->ops; i++) {
+        int slot = (int)(nextRandom(&seed) % (unsigned)(w->keys / w->threads));
+        ElemType key = (ElemType)(slot * w->threads + w->id);
+        Status expectSuccess;
+
+        if (nextRandom(&seed) & 1u) {
+            expectSuccess = w->expected[key] ? ERROR : SUCCESS;
+            if (InsertList_Conc(w->list, r, key) != expectSuccess) {
+                fprintf(stderr, "thread %d: insert %d returned the wrong status\n", w->id, key);
+                exit(1);
+            }
+            w->expected[key] = 1;
+        } else {
+            expectSuccess = w->expected[key] ? SUCCESS : ERROR;
+            if (DeleteList_Conc(w->list, r, key) != expectSuccess) {
+                fprintf(stderr, "thread %d: delete %d returned the wrong status\n", w->id, key);
+                exit(1);
+            }
+            w->expected[key] = 0;
+        }
+    }
+
+    EpochUnregister(r);
+    return NULL;
+}
+
+static void *lockFreeWorker(void *arg) {
+    Worker *w = (Worker *)arg;
+    EpochRecord *r = RegisterThread_Conc(w->list);
+    unsigned seed = 0x85ebca6bu * (unsigned)(w->id + 1);
+
+    for (long i = 0; i < w->ops; i++) {
+        unsigned dice = nextRandom(&seed) % 10;
+        ElemType key = (ElemType)(nextRandom(&seed) % (unsigned)w->keys);
+        if (dice == 0) {
+            InsertList_Conc(w->list, r, key);
+        } else if (dice == 1) {
+            DeleteList_Conc(w->list, r, key);
+        } else {
+            SearchList_Conc(w->list, r, key);
+        }
+    }
+
+    EpochUnregister(r);
+    return NULL;
+}
+
+static void *mutexWorker(void *arg) {
+    Worker *w = (Worker *)arg;
+    unsigned seed = 0x85ebca6bu * (unsigned)(w->id + 1);
+
+    for (long i = 0; i < w->ops; i++) {
+        unsigned dice = nextRandom(&seed) % 10;
+        ElemType key = (ElemType)(nextRandom(&seed) % (unsigned)w->keys);
+        LNode *p;
+
+        pthread_mutex_lock(w->lock);
+        p = w->locked;
+        while (p->next != NULL && p->next->data < key) {
+            p = p->next;
+        }
+        if (dice == 0) {
+            if (p->next == NULL || p->next->data != key) {
+                LNode *q = (LNode *)malloc(sizeof(LNode));
+                q->data = key;
+                InsertList(p, q);
+            }
+        } else if (dice == 1) {
+            ElemType e;
+            if (p->next != NULL && p->next->data == key) {
+                DeleteList(p, &e);
+            }
+        }
+        pthread_mutex_unlock(w->lock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Run fn on n threads and return the elapsed wall time
+ */
+static double runThreads(Worker *workers, int n, void *(*fn)(void *)) {
+    pthread_t tids[EPOCH_MAX_THREADS];
+    double t0 = nowSeconds();
+
+    for (int i = 0; i < n; i++) {
+        pthread_create(&tids[i], NULL, fn, &workers[i]);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_join(tids[i], NULL);
+    }
+    return nowSeconds() - t0;
+}
+
+static int stress(int threads, long ops, int keys) {
+    ConcurrentList list;
+    Worker workers[EPOCH_MAX_THREADS];
+    unsigned char *expected = (unsigned char *)calloc((size_t)keys, 1);
+    EpochRecord *r;
+    long expectedCount = 0;
+    int ok = 1;
+
+    InitList_Conc(&list);
+    for (int i = 0; i < threads; i++) {
+        workers[i] = (Worker){&list, NULL, NULL, i, threads, ops, keys, expected};
+    }
+    runThreads(workers, threads, stressWorker);
+
+    r = RegisterThread_Conc(&list);
+    for (int k = 0; k < keys; k++) {
+        expectedCount += expected[k];
+        if (SearchList_Conc(&list, r, k) != (expected[k] ? SUCCESS : ERROR)) {
+            ok = 0;
+        }
+    }
+    seenCount = 0;
+    sortedOk = 1;
+    TraverseList_Conc(&list, r, checkSorted);
+    EpochUnregister(r);
+    ok = ok && sortedOk && seenCount == expectedCount;
+
+    printf("stress threads=%d ops=%ld nodes=%ld %s\n", threads, ops * threads, seenCount, ok ? "OK" : "FAILED");
+    DestroyList_Conc(&list);
+    free(expected);
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = argc > 1 ? atoi(argv[1]) : (int)(cores < 4 ? 4 : cores);
+    long ops = argc > 2 ? atol(argv[2]) : DEFAULT_OPS;
+    int keys = argc > 3 ? atoi(argv[3]) : DEFAULT_KEYS;
+
+    if (maxThreads > EPOCH_MAX_THREADS - 1) {
+        maxThreads = EPOCH_MAX_THREADS - 1;
+    }
+
+    if (!stress(maxThreads, ops, keys)) {
+        return 1;
+    }
+
+    printf("%8s %16s %16s\n", "threads", "lock-free Mops/s", "mutex Mops/s");
+    for (int n = 1; n <= maxThreads; n *= 2) {
+        ConcurrentList list;
+        LinkedList locked;
+        pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+        Worker workers[EPOCH_MAX_THREADS];
+        EpochRecord *r;
+        double lockFree, mutex;
+
+        // 先填充一半的键
+        InitList_Conc(&list);
+        InitList(&locked);
+        r = RegisterThread_Conc(&list);
+        for (int k = keys - 2; k >= 0; k -= 2) {
+            LNode *q = (LNode *)malloc(sizeof(LNode));
+            q->data = k;
+            InsertList(locked, q);
+            InsertList_Conc(&list, r, k);
+        }
+        EpochUnregister(r);
+
+        for (int i = 0; i < n; i++) {
+            workers[i] = (Worker){&list, locked, &lock, i, n, ops, keys, NULL};
+        }
+        lockFree = runThreads(workers, n, lockFreeWorker);
+        mutex = runThreads(workers, n, mutexWorker);
+
+        printf("%8d %16.2f %16.2f\n", n, n * ops / lockFree / 1e6, n * ops / mutex / 1e6);
+        DestroyList_Conc(&list);
+        DestroyList(&locked);
+    }
+    return 0;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file nodePoolBench.c
+ * @brief Compare per-node malloc/free against NodePool for building and destroying a list
+ * @note Linux only: every run happens in a forked child so that its peak RSS can be read
+ *       back with wait4(). Usage: nodePoolBench [nodes]
+ *       The reset run builds the list a second time after ResetNodePool, from the kept slabs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include "linkedList.h"
+#include "nodePool.h"
+
+#define DEFAULT_NODES 10000000L
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Build and destroy a list with malloc/free, the way Week1/main.c does it
+ */
+static void runMalloc(long n, double *buildTime, double *destroyTime) {
+    LinkedList L;
+    LNode *tail;
+    double t0 = nowSeconds();
+
+    InitList(&L);
+    tail = L;
+    for (long i = 0; i < n; i++) {
+        LNode *node = (LNode *)malloc(sizeof(LNode));
+        node->data = (ElemType)i;
+        node->next = NULL;
+        InsertList(tail, node);
+        tail = node;
+    }
+    *buildTime = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    DestroyList(&L);
+    *destroyTime = nowSeconds() - t0;
+}
+
+/**
+ * @brief Append n nodes to a list built from the pool
+ */
+static void buildPoolList(NodePool *pool, PoolList *list, long n) {
+    InitList_Pool(pool, list);
+    for (long i = 0; i < n; i++) {
+        if (InsertList_Pool(pool, list, list->tail, (ElemType)i) == ERROR) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+}
+
+/**
+ * @brief Build a list from a NodePool and hand the whole list back with DestroyList_Pool
+ */
+static void runPool(long n, double *buildTime, double *destroyTime) {
+    NodePool pool;
+    PoolList list;
+    double t0 = nowSeconds();
+
+    InitNodePool(&pool, 0);
+    buildPoolList(&pool, &list, n);
+    *buildTime = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    DestroyList_Pool(&pool, &list);
+    *destroyTime = nowSeconds() - t0;
+    DestroyNodePool(&pool);
+}
+
+/**
+ * @brief Build a list, reset the pool, then time building again from the kept slabs and resetting
+ */
+static void runReset(long n, double *buildTime, double *destroyTime) {
+    NodePool pool;
+    PoolList list;
+    double t0;
+
+    InitNodePool(&pool, 0);
+    buildPoolList(&pool, &list, n);
+    ResetNodePool(&pool);
+
+    t0 = nowSeconds();
+    buildPoolList(&pool, &list, n);
+    *buildTime = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    ResetNodePool(&pool);
+    *destroyTime = nowSeconds() - t0;
+    DestroyNodePool(&pool);
+}
+
+/**
+ * @brief Run one mode in a child process and report its timings and peak RSS
+ */
+static void runChild(const char *name, void (*run)(long, double *, double *), long n) {
+    int fds[2];
+    double times[2] = {0, 0};
+    struct rusage usage;
+    pid_t pid;
+    int status;
+
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        return;
+    }
+
+    pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        run(n, &times[0], &times[1]);
+        if (write(fds[1], times, sizeof(times)) != (ssize_t)sizeof(times)) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+
+    close(fds[1]);
+    if (read(fds[0], times, sizeof(times)) != (ssize_t)sizeof(times)) {
+        fprintf(stderr, "%s: child produced no result\n", name);
+    }
+    close(fds[0]);
+    wait4(pid, &status, 0, &usage);
+
+    printf("%-8s nodes=%ld build=%.3fs destroy=%.6fs peakRSS=%ldKB\n",
+           name, n, times[0], times[1], usage.ru_maxrss);
+}
+
+int main(int argc, char *argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : DEFAULT_NODES;
+
+    runChild("malloc", runMalloc, n);
+    runChild("pool", runPool, n);
+    runChild("reset", runReset, n);
+    return 0;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file rcuListBench.c
+ * @brief Read throughput of RCUList against a LinkedList behind a pthread rwlock
+ * @note Usage: rcuListBench [maxReaders] [readsPerThread] [elements]
+ *       One writer thread keeps inserting, deleting and now and then reversing
+ *       while 1..maxReaders reader threads run SearchList/FindMidNode.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include "linkedList.h"
+#include "rcuList.h"
+
+#define DEFAULT_READS 2000L
+#define DEFAULT_ELEMENTS 1000
+
+typedef struct {
+    RCUList *rcu;
+    LinkedList locked;
+    pthread_rwlock_t *lock;
+    int id;
+    long reads;
+    int elements;
+    atomic_int *stop;
+} Worker;
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *rcuReader(void *arg) {
+    Worker *w = (Worker *)arg;
+    EpochRecord *r = RegisterThread_RCU(w->rcu);
+    unsigned seed = 2654435761u * (unsigned)(w->id + 1);
+    ElemType mid;
+
+    for (long i = 0; i < w->reads; i++) {
+        seed = seed * 1103515245u + 12345u;
+        if (i % 16 == 0) {
+            FindMidNode_RCU(w->rcu, r, &mid);
+        } else {
+            SearchList_RCU(w->rcu, r, (ElemType)(seed % (unsigned)(2 * w->elements)));
+        }
+    }
+
+    EpochUnregister(r);
+    return NULL;
+}
+
+static void *rcuWriter(void *arg) {
+    Worker *w = (Worker *)arg;
+    EpochRecord *r = RegisterThread_RCU(w->rcu);
+    ElemType e;
+    long round = 0;
+
+    while (!atomic_load(w->stop)) {
+        InsertList_RCU(w->rcu, r, (int)(round % w->elements), (ElemType)round);
+        DeleteList_RCU(w->rcu, r, (int)((round * 7) % w->elements), &e);
+        if (++round % 64 == 0) {
+            ReverseList_RCU(w->rcu, r);
+        }
+        usleep(100);
+    }
+
+    EpochUnregister(r);
+    return NULL;
+}
+
+static void *lockedReader(void *arg) {
+    Worker *w = (Worker *)arg;
+    unsigned seed = 2654435761u * (unsigned)(w->id + 1);
+
+    for (long i = 0; i < w->reads; i++) {
+        seed = seed * 1103515245u + 12345u;
+        pthread_rwlock_rdlock(w->lock);
+        if (i % 16 == 0) {
+            FindMidNode(&w->locked);
+        } else {
+            SearchList(w->locked, (ElemType)(seed % (unsigned)(2 * w->elements)));
+        }
+        pthread_rwlock_unlock(w->lock);
+    }
+    return NULL;
+}
+
+static void *lockedWriter(void *arg) {
+    Worker *w = (Worker *)arg;
+    ElemType e;
+    long round = 0;
+
+    while (!atomic_load(w->stop)) {
+        LNode *q = (LNode *)malloc(sizeof(LNode));
+        q->data = (ElemType)round;
+
+        pthread_rwlock_wrlock(w->lock);
+        LNode *p = w->locked;
+        for (long k = round % w->elements; k > 0 && p->next != NULL; k--) {
+            p = p->next;
+        }
+        InsertList(p, q);
+        p = w->locked;
+        for (long k = (round * 7) % w->elements; k > 0 && p->next != NULL; k--) {
+            p = p->next;
+        }
+        DeleteList(p, &e);
+        if (++round % 64 == 0) {
+            ReverseList(&w->locked);
+        }
+        pthread_rwlock_unlock(w->lock);
+        usleep(100);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Run n readers plus one writer, return reads per second
+ */
+static double runMode(Worker *proto, int n, void *(*reader)(void *), void *(*writer)(void *)) {
+    pthread_t readers[EPOCH_MAX_THREADS], writerTid;
+    Worker workers[EPOCH_MAX_THREADS];
+    Worker writerArg = *proto;
+    double t0;
+
+    atomic_store(proto->stop, 0);
+    pthread_create(&writerTid, NULL, writer, &writerArg);
+
+    t0 = nowSeconds();
+    for (int i = 0; i < n; i++) {
+        workers[i] = *proto;
+        workers[i].id = i;
+        pthread_create(&readers[i], NULL, reader, &workers[i]);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_join(readers[i], NULL);
+    }
+    t0 = nowSeconds() - t0;
+
+    atomic_store(proto->stop, 1);
+    pthread_join(writerTid, NULL);
+    return n * proto->reads / t0;
+}
+
+int main(int argc, char *argv[]) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxReaders = argc > 1 ? atoi(argv[1]) : (int)(cores < 4 ? 4 : cores);
+    long reads = argc > 2 ? atol(argv[2]) : DEFAULT_READS;
+    int elements = argc > 3 ? atoi(argv[3]) : DEFAULT_ELEMENTS;
+    atomic_int stop;
+
+    if (maxReaders > EPOCH_MAX_THREADS - 2) {
+        maxReaders = EPOCH_MAX_THREADS - 2;
+    }
+
+    printf("%8s %16s %16s\n", "readers", "rcu Kreads/s", "rwlock Kreads/s");
+    for (int n = 1; n <= maxReaders; n *= 2) {
+        RCUList rcu;
+        LinkedList locked;
+        pthread_rwlock_t lock;
+        EpochRecord *r;
+        Worker proto;
+        double rcuRate, lockedRate;
+
+        InitList_RCU(&rcu);
+        InitList(&locked);
+        pthread_rwlock_init(&lock, NULL);
+        r = RegisterThread_RCU(&rcu);
+        for (int k = 0; k < elements; k++) {
+            LNode *q = (LNode *)malloc(sizeof(LNode));
+            q->data = k;
+            InsertList(locked, q);
+            InsertList_RCU(&rcu, r, 0, k);
+        }
+        EpochUnregister(r);
+
+        proto = (Worker){&rcu, locked, &lock, 0, reads, elements, &stop};
+        rcuRate = runMode(&proto, n, rcuReader, rcuWriter);
+        lockedRate = runMode(&proto, n, lockedReader, lockedWriter);
+
+        printf("%8d %16.1f %16.1f\n", n, rcuRate / 1e3, lockedRate / 1e3);
+        DestroyList_RCU(&rcu);
+        DestroyList(&proto.locked);
+        pthread_rwlock_destroy(&lock);
+    }
+    return 0;
+}
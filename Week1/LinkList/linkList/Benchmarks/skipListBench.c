@@ -0,0 +1,79 @@
+/**
+ * @file skipListBench.c
+ * @brief Find the list length where SearchSkipList starts to beat the linear SearchList
+ * @note Usage: skipListBench [maxElements]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linkedList.h"
+#include "skipList.h"
+
+#define DEFAULT_MAX_ELEMENTS (1L << 20)
+#define LOOKUP_BUDGET 20000000L   /**< roughly the number of node visits per measurement */
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    long maxElements = argc > 1 ? atol(argv[1]) : DEFAULT_MAX_ELEMENTS;
+    long crossover = -1;
+
+    printf("%10s %10s %14s %14s\n", "elements", "lookups", "linear ns/op", "skip ns/op");
+
+    for (long n = 4; n <= maxElements; n *= 2) {
+        LinkedList L;
+        LNode *tail;
+        SkipList S;
+        long lookups = LOOKUP_BUDGET / n < 1000 ? 1000 : LOOKUP_BUDGET / n;
+        long found = 0;
+        double t0, linear, skip;
+
+        // even values only, so that odd keys miss
+        InitList(&L);
+        tail = L;
+        for (long i = 0; i < n; i++) {
+            LNode *node = (LNode *)malloc(sizeof(LNode));
+            node->data = (ElemType)(2 * i);
+            node->next = NULL;
+            InsertList(tail, node);
+            tail = node;
+        }
+
+        srand(7);
+        t0 = nowSeconds();
+        for (long k = 0; k < lookups; k++) {
+            found += SearchList(L, (ElemType)(rand() % (2 * n)));
+        }
+        linear = (nowSeconds() - t0) / lookups * 1e9;
+
+        AttachSkipList(&S, L);
+        srand(7);
+        t0 = nowSeconds();
+        for (long k = 0; k < lookups; k++) {
+            found -= SearchSkipList(&S, (ElemType)(rand() % (2 * n)));
+        }
+        skip = (nowSeconds() - t0) / lookups * 1e9;
+
+        if (found != 0) {
+            fprintf(stderr, "mismatch at %ld elements\n", n);
+            return 1;
+        }
+        if (crossover < 0 && skip < linear) {
+            crossover = n;
+        }
+
+        printf("%10ld %10ld %14.1f %14.1f\n", n, lookups, linear, skip);
+        DestroySkipList(&S);
+    }
+
+    printf("crossover: %ld elements\n", crossover);
+    return 0;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file unrolledBench.c
+ * @brief Compare SearchList on LNode lists against SearchList_UL on unrolled lists
+ * @note Usage: unrolledBench [elements] [lookups]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "linkedList.h"
+#include "unrolledList.h"
+
+#define DEFAULT_ELEMENTS 1000000L
+#define DEFAULT_LOOKUPS 200L
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char *argv[]) {
+    long n = argc > 1 ? atol(argv[1]) : DEFAULT_ELEMENTS;
+    long lookups = argc > 2 ? atol(argv[2]) : DEFAULT_LOOKUPS;
+    LinkedList L;
+    UnrolledList U;
+    LNode *tail;
+    ULNode *utail;
+    long hits = 0, uhits = 0;
+    double t0, linear, unrolled;
+
+    InitList(&L);
+    InitList_UL(&U);
+    tail = L;
+    utail = U;
+    for (long i = 0; i < n; i++) {
+        LNode *node = (LNode *)malloc(sizeof(LNode));
+        node->data = (ElemType)i;
+        node->next = NULL;
+        InsertList(tail, node);
+        tail = node;
+        AppendList_UL(&utail, (ElemType)i);
+    }
+
+    // half of the keys hit somewhere in the list, half miss and scan it all
+    srand(42);
+    t0 = nowSeconds();
+    for (long k = 0; k < lookups; k++) {
+        hits += SearchList(L, (ElemType)(rand() % (2 * n)));
+    }
+    linear = nowSeconds() - t0;
+
+    srand(42);
+    t0 = nowSeconds();
+    for (long k = 0; k < lookups; k++) {
+        uhits += SearchList_UL(U, (ElemType)(rand() % (2 * n)));
+    }
+    unrolled = nowSeconds() - t0;
+
+    printf("elements=%ld lookups=%ld\n", n, lookups);
+    printf("LNode    %.3fs hits=%ld\n", linear, hits);
+    printf("ULNode   %.3fs hits=%ld speedup=%.2fx\n", unrolled, uhits, linear / unrolled);
+
+    DestroyList(&L);
+    DestroyList_UL(&U);
+    return 0;
+}
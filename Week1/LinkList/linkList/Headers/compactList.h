@@ -0,0 +1,96 @@
+/***************************************************************************************
+ *	File Name				:	compactList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef COMPACTLIST_H_INCLUDED
+#define COMPACTLIST_H_INCLUDED
+
+#include "linkedList.h"
+#include "nodePool.h"
+
+/**************************************************************
+*	Macro Define Section
+**************************************************************/
+
+// a link that moves forward by at most this many bytes stays within the next cache line,
+// so malloc headers or padding between consecutive nodes do not count as fragmentation
+#define COMPACT_NEAR_BYTES 64
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct of the automatic relayout trigger
+typedef struct CompactPolicy {
+	double threshold;			// relayout once ListFragmentation goes above this
+	unsigned long interval;		// mutations between two measurements
+	unsigned long pending;		// mutations since the last measurement
+	unsigned long compactions;	// relayouts done so far
+} CompactPolicy;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : double ListFragmentation(LinkedList L)
+ *	@description : fraction of links that point backwards in memory or more than
+ *                 COMPACT_NEAR_BYTES forwards
+ *	@param		 : L(the head node)
+ *	@return		 : 0.0 for a list laid out in order, from a pool or from malloc, close to 1.0 for
+ *                 scattered nodes
+ *  @notice      : O(n), works on any list
+ */
+double ListFragmentation(LinkedList L);
+
+/**
+ *  @name        : Status CompactList(NodePool *pool, PoolList *list)
+ *	@description : copy the list in order into one contiguous slab and release the old nodes
+ *	@param		 : pool(owner of the nodes, replaced by a new pool), list(head, tail and length replaced)
+ *	@return		 : Status
+ *  @notice      : pool must hold no other list; any pointer into the old list becomes invalid.
+ *                 A pool that has never handed out a node means the nodes came from malloc: set
+ *                 list->head to the list and call SyncList_Pool first, the old nodes are freed one
+ *                 by one. Either way the nodes belong to pool afterwards, so insert and delete
+ *                 only through InsertList_Pool and DeleteList_Pool from then on
+ */
+Status CompactList(NodePool *pool, PoolList *list);
+
+/**
+ *  @name        : void InitCompactPolicy(CompactPolicy *policy, double threshold, unsigned long interval)
+ *	@description : set up an automatic relayout trigger
+ *	@param		 : policy, threshold, interval(0 means measure on every mutation)
+ *	@return		 : None
+ *  @notice      : None
+ */
+void InitCompactPolicy(CompactPolicy *policy, double threshold, unsigned long interval);
+
+/**
+ *  @name        : Status NoteListMutation(CompactPolicy *policy, NodePool *pool, PoolList *list)
+ *	@description : call after each InsertList_Pool/DeleteList_Pool on list, every interval calls the
+ *                 fragmentation is measured and CompactList runs when it is above the threshold
+ *	@param		 : policy, pool(owner of every node of list), list
+ *	@return		 : Status(ERROR only if a relayout was needed and failed)
+ *  @notice      : runs on the caller's thread, the list has no lock a separate thread could take;
+ *                 plain InsertList/DeleteList must not be used on list, they would mix malloc'd
+ *                 nodes into the pool's list or free a node inside a slab
+ */
+Status NoteListMutation(CompactPolicy *policy, NodePool *pool, PoolList *list);
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
@@ -0,0 +1,113 @@
+/***************************************************************************************
+ *	File Name				:	concurrentList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef CONCURRENTLIST_H_INCLUDED
+#define CONCURRENTLIST_H_INCLUDED
+
+#include <stdint.h>
+#include <stdatomic.h>
+#include "linkedList.h"
+#include "epoch.h"
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct of lock-free list node, the lowest bit of next marks the node as deleted
+typedef struct CLNode {
+	ElemType data;
+	_Atomic(uintptr_t) next;
+	EpochRetired retired;
+} CLNode;
+
+// define struct of Harris-style lock-free sorted list
+typedef struct ConcurrentList {
+	CLNode head;			// head node without value, never deleted
+	EpochDomain domain;		// reclaims unlinked nodes
+} ConcurrentList;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : Status InitList_Conc(ConcurrentList *L)
+ *	@description : initialize an empty lock-free list
+ *	@param		 : L
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InitList_Conc(ConcurrentList *L);
+
+/**
+ *  @name        : void DestroyList_Conc(ConcurrentList *L)
+ *	@description : free all the nodes and everything still waiting for reclamation
+ *	@param		 : L
+ *	@return		 : None
+ *  @notice      : no other thread may use L any more
+ */
+void DestroyList_Conc(ConcurrentList *L);
+
+/**
+ *  @name        : EpochRecord* RegisterThread_Conc(ConcurrentList *L)
+ *	@description : register the calling thread, the record is passed to every other call of this thread
+ *	@param		 : L
+ *	@return		 : EpochRecord(NULL when EPOCH_MAX_THREADS threads are registered)
+ *  @notice      : give it back with EpochUnregister before the thread exits
+ */
+EpochRecord* RegisterThread_Conc(ConcurrentList *L);
+
+/**
+ *  @name        : Status InsertList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e)
+ *	@description : insert e in ascending order, lock-free
+ *	@param		 : L, r(record of the calling thread), e
+ *	@return		 : Status(ERROR if e is already in the list)
+ *  @notice      : the list is a set, values are unique
+ */
+Status InsertList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e);
+
+/**
+ *  @name        : Status DeleteList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e)
+ *	@description : delete e, first marking its node and then unlinking it, lock-free
+ *	@param		 : L, r(record of the calling thread), e
+ *	@return		 : Status(ERROR if e is not in the list)
+ *  @notice      : None
+ */
+Status DeleteList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e);
+
+/**
+ *  @name        : Status SearchList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e)
+ *	@description : find e without helping to unlink, writes nothing shared but the epoch announcement
+ *	@param		 : L, r(record of the calling thread), e
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status SearchList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e);
+
+/**
+ *  @name        : void TraverseList_Conc(ConcurrentList *L, EpochRecord *r, void (*visit)(ElemType e))
+ *	@description : visit every node that is not marked as deleted
+ *	@param		 : L, r(record of the calling thread), visit
+ *	@return		 : None
+ *  @notice      : not a snapshot, concurrent updates may or may not be seen
+ */
+void TraverseList_Conc(ConcurrentList *L, EpochRecord *r, void (*visit)(ElemType e));
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
@@ -0,0 +1,142 @@
+/***************************************************************************************
+ *	File Name				:	epoch.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef EPOCH_H_INCLUDED
+#define EPOCH_H_INCLUDED
+
+#include <stddef.h>
+#include <stdatomic.h>
+
+/**************************************************************
+*	Macro Define Section
+**************************************************************/
+
+// threads that can be registered with one domain at the same time
+#define EPOCH_MAX_THREADS 64
+
+// retirements between two attempts to advance the global epoch
+#define EPOCH_ADVANCE_EVERY 64
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct embedded in every object that is reclaimed through an epoch domain
+typedef struct EpochRetired {
+	struct EpochRetired *next;
+	void (*destroy)(struct EpochRetired *retired);	// frees the object holding this header
+} EpochRetired;
+
+struct EpochDomain;
+
+// define struct of the per-thread state, one per registered thread
+typedef struct EpochRecord {
+	atomic_uint state;					// (announced epoch << 1) | inside critical section
+	atomic_int inUse;					// record owned by a thread
+	struct EpochDomain *domain;
+	EpochRetired *limbo[3];				// retired objects, bucketed by epoch % 3
+	unsigned limboEpoch[3];				// epoch each bucket was filled in
+	unsigned retires;					// retirements since the last advance attempt
+	char pad[64];						// keep neighbouring records off this cache line
+} EpochRecord;
+
+// define struct of epoch-based reclamation domain
+typedef struct EpochDomain {
+	atomic_uint epoch;
+	EpochRecord records[EPOCH_MAX_THREADS];
+} EpochDomain;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : void InitEpochDomain(EpochDomain *d)
+ *	@description : initialize a domain with no registered thread
+ *	@param		 : d
+ *	@return		 : None
+ *  @notice      : None
+ */
+void InitEpochDomain(EpochDomain *d);
+
+/**
+ *  @name        : void DestroyEpochDomain(EpochDomain *d)
+ *	@description : free every object still waiting for its grace period
+ *	@param		 : d
+ *	@return		 : None
+ *  @notice      : no thread may be inside a critical section of d
+ */
+void DestroyEpochDomain(EpochDomain *d);
+
+/**
+ *  @name        : EpochRecord* EpochRegister(EpochDomain *d)
+ *	@description : claim a per-thread record, each thread uses its own record only
+ *	@param		 : d
+ *	@return		 : EpochRecord(NULL when EPOCH_MAX_THREADS records are taken)
+ *  @notice      : None
+ */
+EpochRecord* EpochRegister(EpochDomain *d);
+
+/**
+ *  @name        : void EpochUnregister(EpochRecord *r)
+ *	@description : wait for the grace period of everything r retired, free it and give r back
+ *	@param		 : r
+ *	@return		 : None
+ *  @notice      : must be called outside a critical section
+ */
+void EpochUnregister(EpochRecord *r);
+
+/**
+ *  @name        : void EpochEnter(EpochRecord *r)
+ *	@description : start a critical section, nodes reached from here stay valid until EpochExit
+ *	@param		 : r
+ *	@return		 : None
+ *  @notice      : not reentrant
+ */
+void EpochEnter(EpochRecord *r);
+
+/**
+ *  @name        : void EpochExit(EpochRecord *r)
+ *	@description : end a critical section
+ *	@param		 : r
+ *	@return		 : None
+ *  @notice      : None
+ */
+void EpochExit(EpochRecord *r);
+
+/**
+ *  @name        : void EpochRetire(EpochRecord *r, EpochRetired *retired)
+ *	@description : hand over an unlinked object, retired->destroy runs once no reader can still hold it
+ *	@param		 : r, retired
+ *	@return		 : None
+ *  @notice      : the object must already be unreachable for new readers
+ */
+void EpochRetire(EpochRecord *r, EpochRetired *retired);
+
+/**
+ *  @name        : void EpochSynchronize(EpochRecord *r)
+ *	@description : wait until every object r retired so far has been freed
+ *	@param		 : r
+ *	@return		 : None
+ *  @notice      : must be called outside a critical section, spins while another thread stays inside one
+ */
+void EpochSynchronize(EpochRecord *r);
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
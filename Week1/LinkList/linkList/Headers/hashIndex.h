@@ -0,0 +1,112 @@
+/***************************************************************************************
+ *	File Name				:	hashIndex.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef HASHINDEX_H_INCLUDED
+#define HASHINDEX_H_INCLUDED
+
+#include <stddef.h>
+#include "linkedList.h"
+
+/**************************************************************
+*	Macro Define Section
+**************************************************************/
+
+// smallest table, must be a power of two
+#define HASH_INDEX_MIN_CAPACITY 16
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct of one slot, node == NULL means the slot is empty
+typedef struct HashEntry {
+	ElemType key;			// copy of node->data, avoids touching the node while probing
+	LNode *node;			// an indexed node
+	LNode *prev;			// the node before it in the list
+} HashEntry;
+
+// define struct of hash index attached to a list head, linear probing
+typedef struct HashIndex {
+	LinkedList head;		// the indexed list
+	HashEntry *slots;
+	size_t capacity;		// power of two, kept at least twice count
+	size_t count;			// nodes indexed, one slot per node
+	int shift;				// 32 - log2(capacity), for fibonacci hashing
+} HashIndex;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : Status AttachHashIndex(HashIndex *H, LinkedList L)
+ *	@description : build a hash index over every node of the list L
+ *	@param		 : H, L(the head node)
+ *	@return		 : Status
+ *  @notice      : O(n); also the way to resync after ReverseList and other calls that relink nodes behind the index
+ */
+Status AttachHashIndex(HashIndex *H, LinkedList L);
+
+/**
+ *  @name        : void DetachHashIndex(HashIndex *H)
+ *	@description : free the index, the list itself is left untouched
+ *	@param		 : H
+ *	@return		 : None
+ *  @notice      : None
+ */
+void DetachHashIndex(HashIndex *H);
+
+/**
+ *  @name        : Status InsertList_Hash(HashIndex *H, LNode *p, LNode *q)
+ *	@description : same as InsertList, and index q
+ *	@param		 : H, p, q
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InsertList_Hash(HashIndex *H, LNode *p, LNode *q);
+
+/**
+ *  @name        : Status DeleteList_Hash(HashIndex *H, LNode *p, ElemType *e)
+ *	@description : same as DeleteList, and drop the deleted node from the index
+ *	@param		 : H, p, e
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status DeleteList_Hash(HashIndex *H, LNode *p, ElemType *e);
+
+/**
+ *  @name        : Status SearchList_Hash(HashIndex *H, ElemType e)
+ *	@description : O(1) membership test, same answer as SearchList(H->head, e)
+ *	@param		 : H, e
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status SearchList_Hash(HashIndex *H, ElemType e);
+
+/**
+ *  @name        : LNode* LocatePrev_Hash(HashIndex *H, ElemType e)
+ *	@description : find the node before a node whose value is e, ready for DeleteList_Hash(H, p, &e)
+ *	@param		 : H, e
+ *	@return		 : LNode(NULL if e is not in the list)
+ *  @notice      : with duplicate values any one of them may be picked
+ */
+LNode* LocatePrev_Hash(HashIndex *H, ElemType e);
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
@@ -92,6 +92,15 @@ Status DeleteList(LNode *p, ElemType *e);
  */
 void TraverseList(LinkedList L, void (*visit)(ElemType e));
 
+/**
+ *  @name        : void TraverseListBatch(LinkedList L, ElemType *buffer, int size, void (*visit)(const ElemType *block, int n))
+ *	@description : traverse the linked list, gather up to size values into buffer and call visit once per block
+ *	@param		 : L(the head node), buffer, size(capacity of buffer), visit
+ *	@return		 : None
+ *  @notice      : saves the per-node visit call only, the walk is still one dependent load per node
+ */
+void TraverseListBatch(LinkedList L, ElemType *buffer, int size, void (*visit)(const ElemType *block, int n));
+
 /**
  *  @name        : Status SearchList(LinkedList L, ElemType e)
  *	@description : find the first node in the linked list according to e
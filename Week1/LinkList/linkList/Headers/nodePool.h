@@ -0,0 +1,159 @@
+/***************************************************************************************
+ *	File Name				:	nodePool.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef NODEPOOL_H_INCLUDED
+#define NODEPOOL_H_INCLUDED
+
+#include <stddef.h>
+#include "linkedList.h"
+
+/**************************************************************
+*	Macro Define Section
+**************************************************************/
+
+// default number of nodes carved out of one slab
+#define NODE_POOL_DEFAULT_SLAB 4096
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct of a contiguous block of nodes
+typedef struct NodeSlab {
+	struct NodeSlab *next;
+	size_t capacity;
+	LNode nodes[];
+} NodeSlab;
+
+// define struct of node pool
+typedef struct NodePool {
+	NodeSlab *slabs;		// slabs in use since the last reset, newest first
+	NodeSlab *spare;		// slabs kept by ResetNodePool, taken before calling malloc
+	LNode *freeList;		// recycled nodes, chained through next
+	size_t slabNodes;		// nodes per slab
+	size_t bump;			// next unused index in slabs->nodes
+	size_t live;			// nodes currently handed out
+} NodePool;
+
+// define struct of a list built from a pool, the insert and delete helpers keep tail and
+// length up to date so that the whole list can be handed back in O(1)
+typedef struct PoolList {
+	LinkedList head;		// the head node, from the pool
+	LNode *tail;			// last node, head when the list is empty
+	size_t length;			// nodes after the head
+} PoolList;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : Status InitNodePool(NodePool *pool, size_t slabNodes)
+ *	@description : initialize an empty node pool, no memory is allocated until the first node
+ *	@param		 : pool, slabNodes(nodes per slab, 0 means NODE_POOL_DEFAULT_SLAB)
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InitNodePool(NodePool *pool, size_t slabNodes);
+
+/**
+ *  @name        : void DestroyNodePool(NodePool *pool)
+ *	@description : free every slab of the pool, all nodes from the pool become invalid
+ *	@param		 : pool
+ *	@return		 : None
+ *  @notice      : None
+ */
+void DestroyNodePool(NodePool *pool);
+
+/**
+ *  @name        : void ResetNodePool(NodePool *pool)
+ *	@description : give every node back to the pool at once but keep the slabs for reuse
+ *	@param		 : pool
+ *	@return		 : None
+ *  @notice      : O(number of slabs), all lists built from the pool become invalid; the kept slabs
+ *                 are handed out again before any new slab is allocated
+ */
+void ResetNodePool(NodePool *pool);
+
+/**
+ *  @name        : LNode* AllocNode(NodePool *pool, ElemType e)
+ *	@description : take a node from the free list or the current slab and set its value to e
+ *	@param		 : pool, e
+ *	@return		 : LNode(NULL if out of memory)
+ *  @notice      : None
+ */
+LNode* AllocNode(NodePool *pool, ElemType e);
+
+/**
+ *  @name        : void FreeNode(NodePool *pool, LNode *node)
+ *	@description : give a single node back to the free list of the pool
+ *	@param		 : pool, node
+ *	@return		 : None
+ *  @notice      : node must come from the same pool
+ */
+void FreeNode(NodePool *pool, LNode *node);
+
+/**
+ *  @name        : Status InitList_Pool(NodePool *pool, PoolList *list)
+ *	@description : same as InitList, but the head node comes from the pool
+ *	@param		 : pool, list
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InitList_Pool(NodePool *pool, PoolList *list);
+
+/**
+ *  @name        : Status InsertList_Pool(NodePool *pool, PoolList *list, LNode *p, ElemType e)
+ *	@description : take a node holding e from the pool and insert it after p
+ *	@param		 : pool, list, p(a node of list, list->tail to append), e
+ *	@return		 : Status(ERROR if out of memory)
+ *  @notice      : O(1)
+ */
+Status InsertList_Pool(NodePool *pool, PoolList *list, LNode *p, ElemType e);
+
+/**
+ *  @name        : Status DeleteList_Pool(NodePool *pool, PoolList *list, LNode *p, ElemType *e)
+ *	@description : same as DeleteList, but the node goes back to the pool instead of free
+ *	@param		 : pool, list, p, e
+ *	@return		 : Status
+ *  @notice      : O(1)
+ */
+Status DeleteList_Pool(NodePool *pool, PoolList *list, LNode *p, ElemType *e);
+
+/**
+ *  @name        : void SyncList_Pool(PoolList *list)
+ *	@description : find tail and length again by walking the list
+ *	@param		 : list
+ *	@return		 : None
+ *  @notice      : O(n); needed after the nodes were relinked by calls that do not know the
+ *                 handle, such as InsertList or ReverseList on list->head
+ */
+void SyncList_Pool(PoolList *list);
+
+/**
+ *  @name        : void DestroyList_Pool(NodePool *pool, PoolList *list)
+ *	@description : give the whole list, head node included, back to the pool
+ *	@param		 : pool, list
+ *	@return		 : None
+ *  @notice      : O(1), the chain from head to tail is spliced onto the free list as it is
+ */
+void DestroyList_Pool(NodePool *pool, PoolList *list);
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
@@ -0,0 +1,132 @@
+/***************************************************************************************
+ *	File Name				:	rcuList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef RCULIST_H_INCLUDED
+#define RCULIST_H_INCLUDED
+
+#include <stdatomic.h>
+#include <pthread.h>
+#include "linkedList.h"
+#include "epoch.h"
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct of read-mostly list node
+typedef struct RCUNode {
+	ElemType data;
+	_Atomic(struct RCUNode *) next;
+	EpochRetired retired;
+} RCUNode;
+
+// define struct of read-mostly list: readers take no lock, writers take writeLock
+typedef struct RCUList {
+	RCUNode head;				// head node without value
+	pthread_mutex_t writeLock;	// serializes writers only
+	EpochDomain domain;			// reclaims nodes after every reader has moved on
+} RCUList;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : Status InitList_RCU(RCUList *L)
+ *	@description : initialize an empty read-mostly list
+ *	@param		 : L
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InitList_RCU(RCUList *L);
+
+/**
+ *  @name        : void DestroyList_RCU(RCUList *L)
+ *	@description : free all the nodes and everything still waiting for its grace period
+ *	@param		 : L
+ *	@return		 : None
+ *  @notice      : no other thread may use L any more
+ */
+void DestroyList_RCU(RCUList *L);
+
+/**
+ *  @name        : EpochRecord* RegisterThread_RCU(RCUList *L)
+ *	@description : register the calling thread, readers and writers alike
+ *	@param		 : L
+ *	@return		 : EpochRecord(NULL when EPOCH_MAX_THREADS threads are registered)
+ *  @notice      : give it back with EpochUnregister before the thread exits
+ */
+EpochRecord* RegisterThread_RCU(RCUList *L);
+
+/**
+ *  @name        : Status InsertList_RCU(RCUList *L, EpochRecord *r, int i, ElemType e)
+ *	@description : writer, insert e after the i-th node (0 means at the front)
+ *	@param		 : L, r, i, e
+ *	@return		 : Status(ERROR if the list has fewer than i nodes)
+ *  @notice      : the node is fully built before one release store makes it visible
+ */
+Status InsertList_RCU(RCUList *L, EpochRecord *r, int i, ElemType e);
+
+/**
+ *  @name        : Status DeleteList_RCU(RCUList *L, EpochRecord *r, int i, ElemType *e)
+ *	@description : writer, delete the node after the i-th node and assign its value to e
+ *	@param		 : L, r, i, e
+ *	@return		 : Status
+ *  @notice      : the node is freed after a grace period, readers still on it are safe
+ */
+Status DeleteList_RCU(RCUList *L, EpochRecord *r, int i, ElemType *e);
+
+/**
+ *  @name        : Status ReverseList_RCU(RCUList *L, EpochRecord *r)
+ *	@description : writer, build a reversed copy and publish it with a single store
+ *	@param		 : L, r
+ *	@return		 : Status
+ *  @notice      : readers see either the old order or the new one, never a mix
+ */
+Status ReverseList_RCU(RCUList *L, EpochRecord *r);
+
+/**
+ *  @name        : void TraverseList_RCU(RCUList *L, EpochRecord *r, void (*visit)(ElemType e))
+ *	@description : reader, traverse the list and call the funtion visit
+ *	@param		 : L, r, visit
+ *	@return		 : None
+ *  @notice      : no lock and no atomic read-modify-write
+ */
+void TraverseList_RCU(RCUList *L, EpochRecord *r, void (*visit)(ElemType e));
+
+/**
+ *  @name        : Status SearchList_RCU(RCUList *L, EpochRecord *r, ElemType e)
+ *	@description : reader, find the first node in the list according to e
+ *	@param		 : L, r, e
+ *	@return		 : Status
+ *  @notice      : no lock and no atomic read-modify-write
+ */
+Status SearchList_RCU(RCUList *L, EpochRecord *r, ElemType e);
+
+/**
+ *  @name        : Status FindMidNode_RCU(RCUList *L, EpochRecord *r, ElemType *e)
+ *	@description : reader, find the middle node and assign its value to e
+ *	@param		 : L, r, e
+ *	@return		 : Status(ERROR if the list is empty)
+ *  @notice      : the value is returned instead of the node, which may be freed after the call
+ */
+Status FindMidNode_RCU(RCUList *L, EpochRecord *r, ElemType *e);
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
@@ -0,0 +1,121 @@
+/***************************************************************************************
+ *	File Name				:	skipList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef SKIPLIST_H_INCLUDED
+#define SKIPLIST_H_INCLUDED
+
+#include <stddef.h>
+#include "linkedList.h"
+
+/**************************************************************
+*	Macro Define Section
+**************************************************************/
+
+// highest express lane above the LNode chain, enough for 2^24 nodes
+#define SKIP_MAX_LEVEL 24
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct of an index tower standing on one LNode
+typedef struct SkipTower {
+	LNode *node;					// the LNode this tower indexes
+	int height;						// number of express lanes of this tower
+	struct SkipTower *forward[];	// next tower on each lane
+} SkipTower;
+
+// define struct of skip list, the data itself is the ordinary sorted LNode chain
+typedef struct SkipList {
+	LinkedList head;		// head node of the chain, usable by TraverseList
+	SkipTower *top;			// tower of the head node, SKIP_MAX_LEVEL lanes
+	int level;				// lanes currently in use
+	size_t size;			// nodes in the chain
+	unsigned seed;			// state of the level generator
+} SkipList;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : Status InitSkipList(SkipList *S)
+ *	@description : initialize an empty skip list with only the head node
+ *	@param		 : S
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status InitSkipList(SkipList *S);
+
+/**
+ *  @name        : Status AttachSkipList(SkipList *S, LinkedList L)
+ *	@description : build the index over an existing linked list sorted in ascending order
+ *	@param		 : S, L(the head node)
+ *	@return		 : Status
+ *  @notice      : O(n), S takes the nodes over, L must not be destroyed separately afterwards
+ */
+Status AttachSkipList(SkipList *S, LinkedList L);
+
+/**
+ *  @name        : LinkedList DetachSkipList(SkipList *S)
+ *	@description : drop the index and hand the sorted chain back as an ordinary linked list
+ *	@param		 : S
+ *	@return		 : LinkedList(the head node)
+ *  @notice      : None
+ */
+LinkedList DetachSkipList(SkipList *S);
+
+/**
+ *  @name        : void DestroySkipList(SkipList *S)
+ *	@description : free the index and all the nodes of the chain
+ *	@param		 : S
+ *	@return		 : None
+ *  @notice      : None
+ */
+void DestroySkipList(SkipList *S);
+
+/**
+ *  @name        : Status InsertSkipList(SkipList *S, ElemType e)
+ *	@description : insert e in ascending order, expected O(log n)
+ *	@param		 : S, e
+ *	@return		 : Status
+ *  @notice      : equal values are kept, the new one goes before the old ones
+ */
+Status InsertSkipList(SkipList *S, ElemType e);
+
+/**
+ *  @name        : Status DeleteSkipList(SkipList *S, ElemType e)
+ *	@description : delete the first node whose value is e, expected O(log n)
+ *	@param		 : S, e
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status DeleteSkipList(SkipList *S, ElemType e);
+
+/**
+ *  @name        : Status SearchSkipList(SkipList *S, ElemType e)
+ *	@description : find e in the skip list, expected O(log n)
+ *	@param		 : S, e
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status SearchSkipList(SkipList *S, ElemType e);
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
@@ -0,0 +1,129 @@
+/***************************************************************************************
+ *	File Name				:	unrolledList.h
+ *	CopyRight				:	2020 QG Studio
+ *	SYSTEM					:   win10
+ *	Create Data				:	2020.3.28
+ *
+ *
+ *--------------------------------Revision History--------------------------------------
+ *	No	version		Data			Revised By			Item			Description
+ *
+ *
+ ***************************************************************************************/
+
+ /**************************************************************
+*	Multi-Include-Prevent Section
+**************************************************************/
+#ifndef UNROLLEDLIST_H_INCLUDED
+#define UNROLLEDLIST_H_INCLUDED
+
+#include "linkedList.h"
+
+/**************************************************************
+*	Macro Define Section
+**************************************************************/
+
+// elements packed into one node, 12 * 4 + 4 + 8 = one 64-byte cache line
+#define UL_NODE_CAP 12
+
+/**************************************************************
+*	Struct Define Section
+**************************************************************/
+
+// define struct of unrolled linked list
+typedef struct ULNode {
+	ElemType data[UL_NODE_CAP];
+	int count;
+	struct ULNode *next;
+} ULNode, *UnrolledList;
+
+
+/**************************************************************
+*	Prototype Declare Section
+**************************************************************/
+
+/**
+ *  @name        : Status InitList_UL(UnrolledList *L)
+ *	@description : initialize an empty unrolled list with only the head node without value
+ *	@param		 : L(the head node)
+ *	@return		 : Status
+ *  @notice      : the head node is the only node with count 0, every other node holds 1..UL_NODE_CAP elements
+ */
+Status InitList_UL(UnrolledList *L);
+
+/**
+ *  @name        : void DestroyList_UL(UnrolledList *L)
+ *	@description : destroy an unrolled list, free all the nodes
+ *	@param		 : L(the head node)
+ *	@return		 : None
+ *  @notice      : None
+ */
+void DestroyList_UL(UnrolledList *L);
+
+/**
+ *  @name        : Status AppendList_UL(ULNode **tail, ElemType e)
+ *	@description : append e after the last element, starting from *tail == head node
+ *	@param		 : tail(the last node, moved forward when a new node is needed), e
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status AppendList_UL(ULNode **tail, ElemType e);
+
+/**
+ *  @name        : Status InsertList_UL(ULNode *p, int i, ElemType e)
+ *	@description : insert e at index i of the node after p, a full node is split in half
+ *	@param		 : p(the node before the target node), i, e
+ *	@return		 : Status
+ *  @notice      : when p is the last node only i == 0 is valid and a new node is created
+ */
+Status InsertList_UL(ULNode *p, int i, ElemType e);
+
+/**
+ *  @name        : Status DeleteList_UL(ULNode *p, int i, ElemType *e)
+ *	@description : delete the element at index i of the node after p and assign its value to e
+ *	@param		 : p(the node before the target node), i, e
+ *	@return		 : Status
+ *  @notice      : the target node is freed once it becomes empty
+ */
+Status DeleteList_UL(ULNode *p, int i, ElemType *e);
+
+/**
+ *  @name        : void TraverseList_UL(UnrolledList L, void (*visit)(ElemType e))
+ *	@description : traverse the unrolled list and call the funtion visit
+ *	@param		 : L(the head node), visit
+ *	@return		 : None
+ *  @notice      : None
+ */
+void TraverseList_UL(UnrolledList L, void (*visit)(ElemType e));
+
+/**
+ *  @name        : Status SearchList_UL(UnrolledList L, ElemType e)
+ *	@description : find e in the unrolled list, comparing one whole node per step
+ *	@param		 : L(the head node), e
+ *	@return		 : Status
+ *  @notice      : uses AVX2 or SSE2 when the compiler targets them, scalar code otherwise
+ */
+Status SearchList_UL(UnrolledList L, ElemType e);
+
+/**
+ *  @name        : Status ReverseList_UL(UnrolledList *L)
+ *	@description : reverse the unrolled list
+ *	@param		 : L(the head node)
+ *	@return		 : Status
+ *  @notice      : None
+ */
+Status ReverseList_UL(UnrolledList *L);
+
+/**
+ *  @name        : ULNode* FindMidNode_UL(UnrolledList *L, int *index)
+ *	@description : find the middle element, same position as FindMidNode picks
+ *	@param		 : L(the head node), index(index of the middle element inside the returned node)
+ *	@return		 : ULNode(the node holding the middle element, the head node if the list is empty)
+ *  @notice      : None
+ */
+ULNode* FindMidNode_UL(UnrolledList *L, int *index);
+
+ /**************************************************************
+*	End-Multi-Include-Prevent Section
+**************************************************************/
+#endif
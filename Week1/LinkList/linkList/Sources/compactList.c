@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "compactList.h"
+
+double ListFragmentation(LinkedList L) {
+    size_t links = 0, jumps = 0;
+    LNode *current;
+
+    if (L == NULL || L->next == NULL) {
+        return 0.0;  // 空链表
+    }
+
+    // 统计向后跳或向前跳出一个缓存行的次数，malloc在节点之间留的头部不算
+    for (current = L; current->next != NULL; current = current->next) {
+        uintptr_t from = (uintptr_t)current, to = (uintptr_t)current->next;
+        links++;
+        if (to < from || to - from > COMPACT_NEAR_BYTES) {
+            jumps++;
+        }
+    }
+
+    return (double)jumps / (double)links;
+}
+
+Status CompactList(NodePool *pool, PoolList *list) {
+    NodePool fresh;
+    LNode *current, *tail, *head;
+    size_t n, length = 0;
+
+    if (pool == NULL || list == NULL || list->head == NULL) {
+        return ERROR;
+    }
+
+    // 连同头节点共length + 1个节点，新池的第一块恰好放下整条链表
+    n = list->length + 1;
+    InitNodePool(&fresh, n);
+
+    head = AllocNode(&fresh, list->head->data);
+    if (head == NULL) {
+        return ERROR;  // 内存分配失败，原链表保持不变
+    }
+    tail = head;
+
+    // 按链表顺序依次复制
+    for (current = list->head->next; current != NULL; current = current->next) {
+        LNode *node = AllocNode(&fresh, current->data);
+        if (node == NULL) {
+            DestroyNodePool(&fresh);
+            return ERROR;  // 内存分配失败，原链表保持不变
+        }
+        tail->next = node;
+        tail = node;
+        length++;
+    }
+
+    // 释放旧节点，池中还可能有ResetNodePool留下的备用块
+    if (pool->slabs == NULL) {
+        DestroyList(&list->head);
+    }
+    DestroyNodePool(pool);
+
+    // 之后新插入的节点仍按原来的块大小申请
+    fresh.slabNodes = pool->slabNodes != 0 ? pool->slabNodes : NODE_POOL_DEFAULT_SLAB;
+    *pool = fresh;
+    list->head = head;
+    list->tail = tail;
+    list->length = length;
+    return SUCCESS;
+}
+
+void InitCompactPolicy(CompactPolicy *policy, double threshold, unsigned long interval) {
+    policy->threshold = threshold;
+    policy->interval = interval;
+    policy->pending = 0;
+    policy->compactions = 0;
+}
+
+Status NoteListMutation(CompactPolicy *policy, NodePool *pool, PoolList *list) {
+    // 每interval次修改才测量一次，摊薄O(n)的测量开销
+    if (++policy->pending < policy->interval) {
+        return SUCCESS;
+    }
+    policy->pending = 0;
+
+    if (ListFragmentation(list->head) <= policy->threshold) {
+        return SUCCESS;
+    }
+
+    if (CompactList(pool, list) == ERROR) {
+        return ERROR;
+    }
+    policy->compactions++;
+    return SUCCESS;
+}
@@ -0,0 +1,181 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include "concurrentList.h"
+
+// next指针最低位作为删除标记
+#define MARK ((uintptr_t)1)
+#define NODE_OF(link) ((CLNode *)((link) & ~MARK))
+
+/**
+ *  @name        : static void DestroyNode_Conc(EpochRetired *retired)
+ *	@description : free the node holding the retired header, called once its grace period is over
+ */
+static void DestroyNode_Conc(EpochRetired *retired) {
+    free((char *)retired - offsetof(CLNode, retired));
+}
+
+/**
+ *  @name        : static int Find_Conc(ConcurrentList *L, EpochRecord *r, ElemType e, CLNode **prev, CLNode **curr)
+ *	@description : find the first node not less than e, unlinking every marked node on the way
+ *	@return		 : 1 if *curr holds e
+ */
+static int Find_Conc(ConcurrentList *L, EpochRecord *r, ElemType e, CLNode **prev, CLNode **curr) {
+    CLNode *p, *c;
+    uintptr_t succ;
+
+retry:
+    p = &L->head;
+    c = NODE_OF(atomic_load(&p->next));
+
+    while (c != NULL) {
+        succ = atomic_load(&c->next);
+
+        // c已被逻辑删除，帮忙把它摘掉
+        if (succ & MARK) {
+            uintptr_t expected = (uintptr_t)c;
+            if (!atomic_compare_exchange_strong(&p->next, &expected, succ & ~MARK)) {
+                goto retry;  // p被改动或被标记，从头再来
+            }
+            EpochRetire(r, &c->retired);
+            c = NODE_OF(succ);
+            continue;
+        }
+
+        if (c->data >= e) {
+            break;
+        }
+        p = c;
+        c = NODE_OF(succ);
+    }
+
+    *prev = p;
+    *curr = c;
+    return c != NULL && c->data == e;
+}
+
+Status InitList_Conc(ConcurrentList *L) {
+    if (L == NULL) {
+        return ERROR;
+    }
+
+    L->head.data = 0;
+    atomic_init(&L->head.next, (uintptr_t)0);
+    InitEpochDomain(&L->domain);
+    return SUCCESS;
+}
+
+void DestroyList_Conc(ConcurrentList *L) {
+    CLNode *current = NODE_OF(atomic_load(&L->head.next));
+    CLNode *temp;
+
+    // 先释放仍在链上的节点，再释放等待回收的节点
+    while (current != NULL) {
+        temp = current;
+        current = NODE_OF(atomic_load(&current->next));
+        free(temp);
+    }
+    atomic_store(&L->head.next, (uintptr_t)0);
+    DestroyEpochDomain(&L->domain);
+}
+
+EpochRecord* RegisterThread_Conc(ConcurrentList *L) {
+    return EpochRegister(&L->domain);
+}
+
+Status InsertList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e) {
+    CLNode *prev, *curr;
+    CLNode *node = (CLNode *)malloc(sizeof(CLNode));
+
+    if (node == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+    node->data = e;
+    node->retired.destroy = DestroyNode_Conc;
+
+    EpochEnter(r);
+    for (;;) {
+        if (Find_Conc(L, r, e, &prev, &curr)) {
+            EpochExit(r);
+            free(node);  // 从未发布过，可直接释放
+            return ERROR;  // 已存在
+        }
+
+        // 在prev和curr之间接入新节点
+        atomic_store_explicit(&node->next, (uintptr_t)curr, memory_order_relaxed);
+        uintptr_t expected = (uintptr_t)curr;
+        if (atomic_compare_exchange_strong(&prev->next, &expected, (uintptr_t)node)) {
+            break;
+        }
+    }
+    EpochExit(r);
+    return SUCCESS;
+}
+
+Status DeleteList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e) {
+    CLNode *prev, *curr;
+    uintptr_t succ;
+
+    EpochEnter(r);
+    for (;;) {
+        if (!Find_Conc(L, r, e, &prev, &curr)) {
+            EpochExit(r);
+            return ERROR;  // 未找到目标节点
+        }
+
+        // 第一步：标记curr，成功者即为删除者
+        succ = atomic_load(&curr->next);
+        if (succ & MARK) {
+            continue;
+        }
+        if (!atomic_compare_exchange_strong(&curr->next, &succ, succ | MARK)) {
+            continue;
+        }
+
+        // 第二步：尝试物理摘除，失败则交给下一次Find
+        uintptr_t expected = (uintptr_t)curr;
+        if (atomic_compare_exchange_strong(&prev->next, &expected, succ)) {
+            EpochRetire(r, &curr->retired);
+        } else {
+            Find_Conc(L, r, e, &prev, &curr);
+        }
+        break;
+    }
+    EpochExit(r);
+    return SUCCESS;
+}
+
+Status SearchList_Conc(ConcurrentList *L, EpochRecord *r, ElemType e) {
+    CLNode *current;
+    uintptr_t succ;
+    Status found = ERROR;
+
+    EpochEnter(r);
+    current = NODE_OF(atomic_load_explicit(&L->head.next, memory_order_acquire));
+    while (current != NULL) {
+        succ = atomic_load_explicit(&current->next, memory_order_acquire);
+        if (current->data >= e) {
+            found = (current->data == e && !(succ & MARK)) ? SUCCESS : ERROR;
+            break;
+        }
+        current = NODE_OF(succ);
+    }
+    EpochExit(r);
+    return found;
+}
+
+void TraverseList_Conc(ConcurrentList *L, EpochRecord *r, void (*visit)(ElemType e)) {
+    CLNode *current;
+    uintptr_t succ;
+
+    EpochEnter(r);
+    current = NODE_OF(atomic_load_explicit(&L->head.next, memory_order_acquire));
+    while (current != NULL) {
+        succ = atomic_load_explicit(&current->next, memory_order_acquire);
+        if (!(succ & MARK)) {
+            visit(current->data);
+        }
+        current = NODE_OF(succ);
+    }
+    EpochExit(r);
+}
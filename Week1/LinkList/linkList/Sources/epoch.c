@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "epoch.h"
+
+/**
+ *  @name        : static void FreeRetired_Epoch(EpochRetired *list)
+ *	@description : run destroy on every object of a limbo list
+ */
+static void FreeRetired_Epoch(EpochRetired *list) {
+    EpochRetired *temp;
+
+    while (list != NULL) {
+        temp = list;
+        list = list->next;
+        temp->destroy(temp);
+    }
+}
+
+/**
+ *  @name        : static void TryAdvance_Epoch(EpochDomain *d)
+ *	@description : move the global epoch forward if every thread inside a critical section has seen it
+ */
+static void TryAdvance_Epoch(EpochDomain *d) {
+    unsigned global = atomic_load(&d->epoch);
+
+    for (int i = 0; i < EPOCH_MAX_THREADS; i++) {
+        EpochRecord *r = &d->records[i];
+        if (!atomic_load(&r->inUse)) {
+            continue;
+        }
+
+        // 仍停留在旧纪元的活跃线程会阻止推进
+        unsigned state = atomic_load(&r->state);
+        if ((state & 1u) && (state >> 1) != global) {
+            return;
+        }
+    }
+
+    atomic_compare_exchange_strong(&d->epoch, &global, global + 1);
+}
+
+/**
+ *  @name        : static void Reclaim_Epoch(EpochRecord *r)
+ *	@description : free every bucket of r that is at least two epochs old
+ */
+static void Reclaim_Epoch(EpochRecord *r) {
+    unsigned global = atomic_load(&r->domain->epoch);
+
+    for (int i = 0; i < 3; i++) {
+        if (r->limbo[i] != NULL && global - r->limboEpoch[i] >= 2) {
+            FreeRetired_Epoch(r->limbo[i]);
+            r->limbo[i] = NULL;
+        }
+    }
+}
+
+void InitEpochDomain(EpochDomain *d) {
+    atomic_init(&d->epoch, 0);
+
+    for (int i = 0; i < EPOCH_MAX_THREADS; i++) {
+        EpochRecord *r = &d->records[i];
+        atomic_init(&r->state, 0);
+        atomic_init(&r->inUse, 0);
+        r->domain = d;
+        r->limbo[0] = r->limbo[1] = r->limbo[2] = NULL;
+        r->limboEpoch[0] = r->limboEpoch[1] = r->limboEpoch[2] = 0;
+        r->retires = 0;
+    }
+}
+
+void DestroyEpochDomain(EpochDomain *d) {
+    // 此时已没有读者，所有待回收对象都可以直接释放
+    for (int i = 0; i < EPOCH_MAX_THREADS; i++) {
+        EpochRecord *r = &d->records[i];
+        for (int k = 0; k < 3; k++) {
+            FreeRetired_Epoch(r->limbo[k]);
+            r->limbo[k] = NULL;
+        }
+        atomic_store(&r->inUse, 0);
+    }
+}
+
+EpochRecord* EpochRegister(EpochDomain *d) {
+    for (int i = 0; i < EPOCH_MAX_THREADS; i++) {
+        int expected = 0;
+        if (atomic_compare_exchange_strong(&d->records[i].inUse, &expected, 1)) {
+            atomic_store(&d->records[i].state, 0);
+            d->records[i].retires = 0;
+            return &d->records[i];
+        }
+    }
+    return NULL;  // 记录已用完
+}
+
+void EpochUnregister(EpochRecord *r) {
+    EpochSynchronize(r);
+    atomic_store(&r->state, 0);
+    atomic_store(&r->inUse, 0);
+}
+
+void EpochEnter(EpochRecord *r) {
+    unsigned global = atomic_load(&r->domain->epoch);
+
+    // 先公布所在纪元，之后读到的指针才受保护
+    atomic_store(&r->state, (global << 1) | 1u);
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+void EpochExit(EpochRecord *r) {
+    atomic_store_explicit(&r->state, 0, memory_order_release);
+}
+
+void EpochRetire(EpochRecord *r, EpochRetired *retired) {
+    unsigned global = atomic_load(&r->domain->epoch);
+    int slot = (int)(global % 3);
+
+    // 同一槽位里残留的对象至少早了三个纪元，可以直接释放
+    if (r->limbo[slot] != NULL && r->limboEpoch[slot] != global) {
+        FreeRetired_Epoch(r->limbo[slot]);
+        r->limbo[slot] = NULL;
+    }
+
+    retired->next = r->limbo[slot];
+    r->limbo[slot] = retired;
+    r->limboEpoch[slot] = global;
+
+    if (++r->retires >= EPOCH_ADVANCE_EVERY) {
+        r->retires = 0;
+        TryAdvance_Epoch(r->domain);
+        Reclaim_Epoch(r);
+    }
+}
+
+void EpochSynchronize(EpochRecord *r) {
+    unsigned target = atomic_load(&r->domain->epoch) + 2;
+
+    // 推进两个纪元后，此前退休的对象都已无人引用
+    while ((int)(atomic_load(&r->domain->epoch) - target) < 0) {
+        TryAdvance_Epoch(r->domain);
+    }
+    Reclaim_Epoch(r);
+}
@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "hashIndex.h"
+
+/**
+ *  @name        : static size_t Home_Hash(const HashIndex *H, ElemType key)
+ *	@description : home slot of key, fibonacci hashing keeps the high bits
+ */
+static size_t Home_Hash(const HashIndex *H, ElemType key) {
+    return (size_t)(((uint32_t)key * 2654435769u) >> H->shift);
+}
+
+/**
+ *  @name        : static void Place_Hash(HashIndex *H, LNode *node, LNode *prev)
+ *	@description : put an entry into the first free slot of its probe sequence, capacity is assumed sufficient
+ */
+static void Place_Hash(HashIndex *H, LNode *node, LNode *prev) {
+    size_t mask = H->capacity - 1;
+    size_t i = Home_Hash(H, node->data);
+
+    while (H->slots[i].node != NULL) {
+        i = (i + 1) & mask;
+    }
+    H->slots[i].key = node->data;
+    H->slots[i].node = node;
+    H->slots[i].prev = prev;
+    H->count++;
+}
+
+/**
+ *  @name        : static Status Resize_Hash(HashIndex *H, size_t capacity)
+ *	@description : move every entry into a fresh table of the given power-of-two capacity
+ */
+static Status Resize_Hash(HashIndex *H, size_t capacity) {
+    HashEntry *old = H->slots;
+    size_t oldCapacity = H->capacity;
+    int bits = 0;
+
+    H->slots = (HashEntry *)calloc(capacity, sizeof(HashEntry));
+    if (H->slots == NULL) {
+        H->slots = old;
+        return ERROR;  // 内存分配失败
+    }
+    while (((size_t)1 << bits) < capacity) {
+        bits++;
+    }
+    H->capacity = capacity;
+    H->shift = 32 - bits;
+    H->count = 0;
+
+    for (size_t i = 0; i < oldCapacity; i++) {
+        if (old[i].node != NULL) {
+            Place_Hash(H, old[i].node, old[i].prev);
+        }
+    }
+    free(old);
+    return SUCCESS;
+}
+
+/**
+ *  @name        : static HashEntry* FindNode_Hash(HashIndex *H, const LNode *node)
+ *	@description : find the slot of exactly this node
+ */
+static HashEntry* FindNode_Hash(HashIndex *H, const LNode *node) {
+    size_t mask = H->capacity - 1;
+    size_t i = Home_Hash(H, node->data);
+
+    while (H->slots[i].node != NULL) {
+        if (H->slots[i].node == node) {
+            return &H->slots[i];
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+/**
+ *  @name        : static HashEntry* FindKey_Hash(HashIndex *H, ElemType key)
+ *	@description : find the slot of any node whose value is key
+ */
+static HashEntry* FindKey_Hash(HashIndex *H, ElemType key) {
+    size_t mask = H->capacity - 1;
+    size_t i = Home_Hash(H, key);
+
+    while (H->slots[i].node != NULL) {
+        if (H->slots[i].key == key) {
+            return &H->slots[i];
+        }
+        i = (i + 1) & mask;
+    }
+    return NULL;
+}
+
+/**
+ *  @name        : static void Remove_Hash(HashIndex *H, HashEntry *entry)
+ *	@description : empty a slot and shift the following entries back, so no tombstones are needed
+ */
+static void Remove_Hash(HashIndex *H, HashEntry *entry) {
+    size_t mask = H->capacity - 1;
+    size_t i = (size_t)(entry - H->slots);
+    size_t j = i;
+
+    for (;;) {
+        j = (j + 1) & mask;
+        if (H->slots[j].node == NULL) {
+            break;
+        }
+
+        // j的元素只有在其起始位置不落在(i, j]区间时才能前移到i
+        size_t k = Home_Hash(H, H->slots[j].key);
+        if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+            H->slots[i] = H->slots[j];
+            i = j;
+        }
+    }
+
+    H->slots[i].node = NULL;
+    H->count--;
+}
+
+Status AttachHashIndex(HashIndex *H, LinkedList L) {
+    size_t n = 0, capacity = HASH_INDEX_MIN_CAPACITY;
+    LNode *prev, *current;
+
+    if (L == NULL) {
+        return ERROR;
+    }
+
+    for (current = L->next; current != NULL; current = current->next) {
+        n++;
+    }
+    while (capacity < 2 * n) {
+        capacity *= 2;
+    }
+
+    H->head = L;
+    H->slots = NULL;
+    H->capacity = 0;
+    H->count = 0;
+    if (Resize_Hash(H, capacity) == ERROR) {
+        return ERROR;
+    }
+
+    // 记录每个节点及其前驱
+    prev = L;
+    for (current = L->next; current != NULL; current = current->next) {
+        Place_Hash(H, current, prev);
+        prev = current;
+    }
+    return SUCCESS;
+}
+
+void DetachHashIndex(HashIndex *H) {
+    free(H->slots);
+    H->slots = NULL;
+    H->capacity = 0;
+    H->count = 0;
+    H->head = NULL;
+}
+
+Status InsertList_Hash(HashIndex *H, LNode *p, LNode *q) {
+    HashEntry *after;
+
+    if (p == NULL || q == NULL) {
+        return ERROR;
+    }
+
+    // 装载因子保持在1/2以下
+    if (2 * (H->count + 1) > H->capacity && Resize_Hash(H, 2 * H->capacity) == ERROR) {
+        return ERROR;
+    }
+
+    InsertList(p, q);
+    Place_Hash(H, q, p);
+
+    // q的后继换了前驱
+    if (q->next != NULL) {
+        after = FindNode_Hash(H, q->next);
+        if (after != NULL) {
+            after->prev = q;
+        }
+    }
+    return SUCCESS;
+}
+
+Status DeleteList_Hash(HashIndex *H, LNode *p, ElemType *e) {
+    HashEntry *entry;
+
+    if (p == NULL || p->next == NULL) {
+        return ERROR;  // p为空或p是最后一个节点
+    }
+
+    entry = FindNode_Hash(H, p->next);
+    if (entry != NULL) {
+        Remove_Hash(H, entry);
+    }
+
+    // 被删节点的后继改由p作前驱
+    if (p->next->next != NULL) {
+        entry = FindNode_Hash(H, p->next->next);
+        if (entry != NULL) {
+            entry->prev = p;
+        }
+    }
+
+    return DeleteList(p, e);
+}
+
+Status SearchList_Hash(HashIndex *H, ElemType e) {
+    return FindKey_Hash(H, e) != NULL ? SUCCESS : ERROR;
+}
+
+LNode* LocatePrev_Hash(HashIndex *H, ElemType e) {
+    HashEntry *entry = FindKey_Hash(H, e);
+
+    return entry != NULL ? entry->prev : NULL;
+}
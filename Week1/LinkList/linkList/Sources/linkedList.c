@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "linkedList.h"
+#include "containerStats.h"
 
 Status InitList(LinkedList *L) {
     // 分配头节点内存
@@ -11,18 +12,22 @@ Status InitList(LinkedList *L) {
     
     // 初始化头节点
     (*L)->next = NULL;
+    STATS_ALLOC(STATS_LINKED_LIST, 1, sizeof(LNode));
     return SUCCESS;
 }
 
 void DestroyList(LinkedList *L) {
     LinkedList temp;
+    STATS_COUNTER(freed);
     
     // 循环释放所有节点内存
     while (*L != NULL) {
         temp = *L;  // 保存当前节点
         *L = (*L)->next;  // 移动到下一个节点
         free(temp);  // 释放当前节点内存
+        STATS_STEP(freed);
     }
+    STATS_FREE(STATS_LINKED_LIST, freed, freed * sizeof(LNode));
 }
 
 Status InsertList(LNode *p, LNode *q) {
@@ -34,6 +39,8 @@ Status InsertList(LNode *p, LNode *q) {
     q->next = p->next;
     p->next = q;
     
+    // 调用者分配的节点插入后归链表所有，由链表负责释放
+    STATS_ALLOC(STATS_LINKED_LIST, 1, sizeof(LNode));
     return SUCCESS;
 }
 
@@ -49,30 +56,66 @@ Status DeleteList(LNode *p, ElemType *e) {
     p->next = q->next;
     
     free(q);  // 释放节点内存
+    STATS_FREE(STATS_LINKED_LIST, 1, sizeof(LNode));
     return SUCCESS;
 }
 
 void TraverseList(LinkedList L, void (*visit)(ElemType e)) {
     LNode *current = L->next;  // 从第一个实际节点开始
+    STATS_COUNTER(visited);
     
     // 遍历所有节点
     while (current != NULL) {
         visit(current->data);  // 访问节点数据
         current = current->next;  // 移动到下一个节点
+        STATS_STEP(visited);
     }
+    STATS_VISIT(STATS_LINKED_LIST, visited);
+}
+
+void TraverseListBatch(LinkedList L, ElemType *buffer, int size, void (*visit)(const ElemType *block, int n)) {
+    LNode *current = L->next;  // 从第一个实际节点开始
+    int n = 0;
+    STATS_COUNTER(visited);
+
+    if (buffer == NULL || size <= 0) {
+        return;
+    }
+
+    // 逐个拷贝到缓冲区，visit按块调用而不是每个节点调用一次
+    while (current != NULL) {
+        buffer[n++] = current->data;
+        current = current->next;
+        STATS_STEP(visited);
+
+        // 缓冲区满了整块交给visit
+        if (n == size) {
+            visit(buffer, n);
+            n = 0;
+        }
+    }
+
+    if (n > 0) {
+        visit(buffer, n);
+    }
+    STATS_VISIT(STATS_LINKED_LIST, visited);
 }
 
 Status SearchList(LinkedList L, ElemType e) {
     LNode *current = L->next;  // 从第一个实际节点开始
+    STATS_COUNTER(visited);
     
     // 遍历查找值为e的节点
     while (current != NULL) {
+        STATS_STEP(visited);
         if (current->data == e) {
+            STATS_VISIT(STATS_LINKED_LIST, visited);
             return SUCCESS;  // 找到目标节点
         }
         current = current->next;
     }
     
+    STATS_VISIT(STATS_LINKED_LIST, visited);
     return ERROR;  // 未找到目标节点
 }
 
@@ -0,0 +1,172 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "nodePool.h"
+
+Status InitNodePool(NodePool *pool, size_t slabNodes) {
+    if (pool == NULL) {
+        return ERROR;
+    }
+
+    pool->slabs = NULL;
+    pool->spare = NULL;
+    pool->freeList = NULL;
+    pool->slabNodes = slabNodes == 0 ? NODE_POOL_DEFAULT_SLAB : slabNodes;
+    pool->bump = 0;
+    pool->live = 0;
+    return SUCCESS;
+}
+
+void DestroyNodePool(NodePool *pool) {
+    NodeSlab *temp;
+
+    // 逐块释放，而不是逐个节点释放
+    while (pool->slabs != NULL) {
+        temp = pool->slabs;
+        pool->slabs = pool->slabs->next;
+        free(temp);
+    }
+    while (pool->spare != NULL) {
+        temp = pool->spare;
+        pool->spare = pool->spare->next;
+        free(temp);
+    }
+
+    pool->freeList = NULL;
+    pool->bump = 0;
+    pool->live = 0;
+}
+
+void ResetNodePool(NodePool *pool) {
+    NodeSlab *slab;
+
+    // 所有块移入备用链表，之后按顺序重新切分，不释放也不重新申请
+    while (pool->slabs != NULL) {
+        slab = pool->slabs;
+        pool->slabs = slab->next;
+        slab->next = pool->spare;
+        pool->spare = slab;
+    }
+
+    pool->freeList = NULL;
+    pool->bump = 0;
+    pool->live = 0;
+}
+
+LNode* AllocNode(NodePool *pool, ElemType e) {
+    LNode *node;
+
+    if (pool->freeList != NULL) {
+        // 优先复用空闲链表中的节点
+        node = pool->freeList;
+        pool->freeList = node->next;
+    } else {
+        // 当前块用完时先取备用块，没有备用块再申请一整块
+        if (pool->slabs == NULL || pool->bump == pool->slabs->capacity) {
+            NodeSlab *slab = pool->spare;
+            if (slab != NULL) {
+                pool->spare = slab->next;
+            } else {
+                slab = (NodeSlab *)malloc(sizeof(NodeSlab) + pool->slabNodes * sizeof(LNode));
+                if (slab == NULL) {
+                    return NULL;  // 内存分配失败
+                }
+                slab->capacity = pool->slabNodes;
+            }
+            slab->next = pool->slabs;
+            pool->slabs = slab;
+            pool->bump = 0;
+        }
+        node = &pool->slabs->nodes[pool->bump++];
+    }
+
+    node->data = e;
+    node->next = NULL;
+    pool->live++;
+    return node;
+}
+
+void FreeNode(NodePool *pool, LNode *node) {
+    if (node == NULL) {
+        return;
+    }
+
+    // 挂到空闲链表头部
+    node->next = pool->freeList;
+    pool->freeList = node;
+    pool->live--;
+}
+
+Status InitList_Pool(NodePool *pool, PoolList *list) {
+    list->head = AllocNode(pool, 0);
+    if (list->head == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+    list->tail = list->head;
+    list->length = 0;
+    return SUCCESS;
+}
+
+Status InsertList_Pool(NodePool *pool, PoolList *list, LNode *p, ElemType e) {
+    LNode *q;
+
+    if (p == NULL) {
+        return ERROR;
+    }
+    q = AllocNode(pool, e);
+    if (q == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+
+    q->next = p->next;
+    p->next = q;
+    if (p == list->tail) {
+        list->tail = q;  // 插在尾节点之后，新节点成为尾节点
+    }
+    list->length++;
+    return SUCCESS;
+}
+
+Status DeleteList_Pool(NodePool *pool, PoolList *list, LNode *p, ElemType *e) {
+    if (p == NULL || p->next == NULL) {
+        return ERROR;  // p为空或p是最后一个节点
+    }
+
+    LNode *q = p->next;  // 要删除的节点
+    *e = q->data;  // 保存节点数据
+
+    // 更新指针
+    p->next = q->next;
+    if (q == list->tail) {
+        list->tail = p;  // 删除的是尾节点，前驱成为尾节点
+    }
+    list->length--;
+
+    FreeNode(pool, q);  // 节点归还给内存池
+    return SUCCESS;
+}
+
+void SyncList_Pool(PoolList *list) {
+    LNode *tail = list->head;
+    size_t length = 0;
+
+    while (tail->next != NULL) {
+        tail = tail->next;
+        length++;
+    }
+    list->tail = tail;
+    list->length = length;
+}
+
+void DestroyList_Pool(NodePool *pool, PoolList *list) {
+    if (list->head == NULL) {
+        return;
+    }
+
+    // 链表本身已经串好，尾节点直接接到空闲链表上
+    list->tail->next = pool->freeList;
+    pool->freeList = list->head;
+    pool->live -= list->length + 1;
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include "rcuList.h"
+
+/**
+ *  @name        : static void DestroyNode_RCU(EpochRetired *retired)
+ *	@description : free the node holding the retired header, called once its grace period is over
+ */
+static void DestroyNode_RCU(EpochRetired *retired) {
+    free((char *)retired - offsetof(RCUNode, retired));
+}
+
+/**
+ *  @name        : static RCUNode* NewNode_RCU(ElemType e, RCUNode *next)
+ *	@description : allocate a node that is complete before anyone can see it
+ */
+static RCUNode* NewNode_RCU(ElemType e, RCUNode *next) {
+    RCUNode *node = (RCUNode *)malloc(sizeof(RCUNode));
+    if (node == NULL) {
+        return NULL;
+    }
+    node->data = e;
+    atomic_init(&node->next, next);
+    node->retired.destroy = DestroyNode_RCU;
+    return node;
+}
+
+/**
+ *  @name        : static RCUNode* Locate_RCU(RCUList *L, int i)
+ *	@description : writer side, the i-th node (0 is the head node), NULL if the list is shorter
+ */
+static RCUNode* Locate_RCU(RCUList *L, int i) {
+    RCUNode *p = &L->head;
+
+    // 写者持锁，没有其他写者，relaxed读取即可
+    while (p != NULL && i > 0) {
+        p = atomic_load_explicit(&p->next, memory_order_relaxed);
+        i--;
+    }
+    return p;
+}
+
+Status InitList_RCU(RCUList *L) {
+    if (L == NULL) {
+        return ERROR;
+    }
+
+    L->head.data = 0;
+    atomic_init(&L->head.next, NULL);
+    if (pthread_mutex_init(&L->writeLock, NULL) != 0) {
+        return ERROR;
+    }
+    InitEpochDomain(&L->domain);
+    return SUCCESS;
+}
+
+void DestroyList_RCU(RCUList *L) {
+    RCUNode *current = atomic_load(&L->head.next);
+    RCUNode *temp;
+
+    // 循环释放所有节点内存
+    while (current != NULL) {
+        temp = current;
+        current = atomic_load_explicit(&current->next, memory_order_relaxed);
+        free(temp);
+    }
+    atomic_store(&L->head.next, NULL);
+    DestroyEpochDomain(&L->domain);
+    pthread_mutex_destroy(&L->writeLock);
+}
+
+EpochRecord* RegisterThread_RCU(RCUList *L) {
+    return EpochRegister(&L->domain);
+}
+
+Status InsertList_RCU(RCUList *L, EpochRecord *r, int i, ElemType e) {
+    RCUNode *p, *q;
+
+    (void)r;
+    pthread_mutex_lock(&L->writeLock);
+    p = Locate_RCU(L, i);
+    if (p == NULL) {
+        pthread_mutex_unlock(&L->writeLock);
+        return ERROR;
+    }
+
+    q = NewNode_RCU(e, atomic_load_explicit(&p->next, memory_order_relaxed));
+    if (q == NULL) {
+        pthread_mutex_unlock(&L->writeLock);
+        return ERROR;  // 内存分配失败
+    }
+
+    // 一次release写入发布新节点
+    atomic_store_explicit(&p->next, q, memory_order_release);
+    pthread_mutex_unlock(&L->writeLock);
+    return SUCCESS;
+}
+
+Status DeleteList_RCU(RCUList *L, EpochRecord *r, int i, ElemType *e) {
+    RCUNode *p, *q;
+
+    pthread_mutex_lock(&L->writeLock);
+    p = Locate_RCU(L, i);
+    q = p != NULL ? atomic_load_explicit(&p->next, memory_order_relaxed) : NULL;
+    if (q == NULL) {
+        pthread_mutex_unlock(&L->writeLock);
+        return ERROR;  // p为空或p是最后一个节点
+    }
+
+    *e = q->data;
+
+    // 摘除后q->next保持不变，正停在q上的读者仍能继续往后走
+    atomic_store_explicit(&p->next, atomic_load_explicit(&q->next, memory_order_relaxed), memory_order_release);
+    EpochRetire(r, &q->retired);
+    pthread_mutex_unlock(&L->writeLock);
+    return SUCCESS;
+}
+
+Status ReverseList_RCU(RCUList *L, EpochRecord *r) {
+    RCUNode *current, *next, *reversed = NULL;
+
+    pthread_mutex_lock(&L->writeLock);
+    current = atomic_load_explicit(&L->head.next, memory_order_relaxed);
+    if (current == NULL) {
+        pthread_mutex_unlock(&L->writeLock);
+        return ERROR;  // 空链表
+    }
+
+    // 原地反转会让读者看到断链，这里先复制出反转后的新链
+    for (RCUNode *p = current; p != NULL; p = atomic_load_explicit(&p->next, memory_order_relaxed)) {
+        RCUNode *node = NewNode_RCU(p->data, reversed);
+        if (node == NULL) {
+            while (reversed != NULL) {
+                next = atomic_load_explicit(&reversed->next, memory_order_relaxed);
+                free(reversed);
+                reversed = next;
+            }
+            pthread_mutex_unlock(&L->writeLock);
+            return ERROR;  // 内存分配失败，原链表保持不变
+        }
+        reversed = node;
+    }
+
+    // 一次写入切换到新链，旧链整体等宽限期后回收
+    atomic_store_explicit(&L->head.next, reversed, memory_order_release);
+    while (current != NULL) {
+        next = atomic_load_explicit(&current->next, memory_order_relaxed);
+        EpochRetire(r, &current->retired);
+        current = next;
+    }
+    pthread_mutex_unlock(&L->writeLock);
+    return SUCCESS;
+}
+
+void TraverseList_RCU(RCUList *L, EpochRecord *r, void (*visit)(ElemType e)) {
+    RCUNode *current;
+
+    EpochEnter(r);
+    current = atomic_load_explicit(&L->head.next, memory_order_acquire);
+    while (current != NULL) {
+        visit(current->data);
+        current = atomic_load_explicit(&current->next, memory_order_acquire);
+    }
+    EpochExit(r);
+}
+
+Status SearchList_RCU(RCUList *L, EpochRecord *r, ElemType e) {
+    RCUNode *current;
+    Status found = ERROR;
+
+    EpochEnter(r);
+    current = atomic_load_explicit(&L->head.next, memory_order_acquire);
+    while (current != NULL) {
+        if (current->data == e) {
+            found = SUCCESS;  // 找到目标节点
+            break;
+        }
+        current = atomic_load_explicit(&current->next, memory_order_acquire);
+    }
+    EpochExit(r);
+    return found;
+}
+
+Status FindMidNode_RCU(RCUList *L, EpochRecord *r, ElemType *e) {
+    RCUNode *slow, *fast, *step;
+    Status found = ERROR;
+
+    EpochEnter(r);
+    slow = atomic_load_explicit(&L->head.next, memory_order_acquire);
+    fast = slow;
+
+    // 快慢指针法找中间节点，并发删除可能让slow先走到尾部
+    while (slow != NULL && fast != NULL && (step = atomic_load_explicit(&fast->next, memory_order_acquire)) != NULL) {
+        slow = atomic_load_explicit(&slow->next, memory_order_acquire);
+        fast = atomic_load_explicit(&step->next, memory_order_acquire);
+    }
+
+    if (slow != NULL) {
+        *e = slow->data;
+        found = SUCCESS;
+    }
+    EpochExit(r);
+    return found;
+}
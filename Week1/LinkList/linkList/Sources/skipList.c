@@ -0,0 +1,239 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "skipList.h"
+
+/**
+ *  @name        : static SkipTower* NewTower_Skip(LNode *node, int height)
+ *	@description : allocate a tower with every lane pointing to NULL
+ */
+static SkipTower* NewTower_Skip(LNode *node, int height) {
+    SkipTower *tower = (SkipTower *)calloc(1, sizeof(SkipTower) + height * sizeof(SkipTower *));
+    if (tower == NULL) {
+        return NULL;
+    }
+    tower->node = node;
+    tower->height = height;
+    return tower;
+}
+
+/**
+ *  @name        : static int RandomHeight_Skip(SkipList *S)
+ *	@description : number of express lanes for a new node, 0 with probability 1/2, 1 with 1/4 ...
+ */
+static int RandomHeight_Skip(SkipList *S) {
+    unsigned r = S->seed;
+    int height = 0;
+
+    // xorshift32
+    r ^= r << 13;
+    r ^= r >> 17;
+    r ^= r << 5;
+    S->seed = r;
+
+    while (height < SKIP_MAX_LEVEL && (r & 1u)) {
+        height++;
+        r >>= 1;
+    }
+    return height;
+}
+
+/**
+ *  @name        : static LNode* FindPrev_Skip(SkipList *S, ElemType e, SkipTower **update)
+ *	@description : find the last node whose value is less than e, recording the last tower visited on each lane
+ */
+static LNode* FindPrev_Skip(SkipList *S, ElemType e, SkipTower **update) {
+    SkipTower *x = S->top;
+    LNode *p;
+
+    // 从最高层开始，逐层向下逼近
+    for (int l = S->level - 1; l >= 0; l--) {
+        while (x->forward[l] != NULL && x->forward[l]->node->data < e) {
+            x = x->forward[l];
+        }
+        if (update != NULL) {
+            update[l] = x;
+        }
+    }
+
+    // 最后在原链表上走完剩下的几步
+    p = x->node;
+    while (p->next != NULL && p->next->data < e) {
+        p = p->next;
+    }
+    return p;
+}
+
+Status InitSkipList(SkipList *S) {
+    if (InitList(&S->head) == ERROR) {
+        return ERROR;  // 内存分配失败
+    }
+
+    S->top = NewTower_Skip(S->head, SKIP_MAX_LEVEL);
+    if (S->top == NULL) {
+        DestroyList(&S->head);
+        return ERROR;  // 内存分配失败
+    }
+
+    S->level = 0;
+    S->size = 0;
+    S->seed = 2463534242u;
+    return SUCCESS;
+}
+
+Status AttachSkipList(SkipList *S, LinkedList L) {
+    SkipTower *last[SKIP_MAX_LEVEL];
+    LNode *current;
+
+    if (L == NULL) {
+        return ERROR;
+    }
+
+    // 先确认链表升序
+    for (current = L->next; current != NULL && current->next != NULL; current = current->next) {
+        if (current->data > current->next->data) {
+            return ERROR;
+        }
+    }
+
+    S->head = L;
+    S->top = NewTower_Skip(L, SKIP_MAX_LEVEL);
+    if (S->top == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+    S->level = 0;
+    S->size = 0;
+    S->seed = 2463534242u;
+
+    for (int l = 0; l < SKIP_MAX_LEVEL; l++) {
+        last[l] = S->top;
+    }
+
+    // 顺序扫描一遍，每层接在该层最后一个塔之后
+    for (current = L->next; current != NULL; current = current->next) {
+        int height = RandomHeight_Skip(S);
+        S->size++;
+        if (height == 0) {
+            continue;
+        }
+
+        SkipTower *tower = NewTower_Skip(current, height);
+        if (tower == NULL) {
+            DetachSkipList(S);
+            return ERROR;  // 内存分配失败
+        }
+        for (int l = 0; l < height; l++) {
+            last[l]->forward[l] = tower;
+            last[l] = tower;
+        }
+        if (height > S->level) {
+            S->level = height;
+        }
+    }
+
+    return SUCCESS;
+}
+
+LinkedList DetachSkipList(SkipList *S) {
+    LinkedList L = S->head;
+    SkipTower *tower, *temp;
+
+    // 第0层串起了所有的塔
+    tower = S->top->forward[0];
+    while (tower != NULL) {
+        temp = tower;
+        tower = tower->forward[0];
+        free(temp);
+    }
+    free(S->top);
+
+    S->top = NULL;
+    S->head = NULL;
+    S->level = 0;
+    S->size = 0;
+    return L;
+}
+
+void DestroySkipList(SkipList *S) {
+    LinkedList L = DetachSkipList(S);
+    DestroyList(&L);
+}
+
+Status InsertSkipList(SkipList *S, ElemType e) {
+    SkipTower *update[SKIP_MAX_LEVEL];
+    LNode *p, *q;
+    int height;
+
+    p = FindPrev_Skip(S, e, update);
+
+    q = (LNode *)malloc(sizeof(LNode));
+    if (q == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+    q->data = e;
+    InsertList(p, q);
+    S->size++;
+
+    height = RandomHeight_Skip(S);
+    if (height == 0) {
+        return SUCCESS;
+    }
+
+    SkipTower *tower = NewTower_Skip(q, height);
+    if (tower == NULL) {
+        return SUCCESS;  // 没有索引也不影响正确性
+    }
+
+    // 新启用的层从头塔开始
+    for (int l = S->level; l < height; l++) {
+        update[l] = S->top;
+    }
+    if (height > S->level) {
+        S->level = height;
+    }
+
+    for (int l = 0; l < height; l++) {
+        tower->forward[l] = update[l]->forward[l];
+        update[l]->forward[l] = tower;
+    }
+    return SUCCESS;
+}
+
+Status DeleteSkipList(SkipList *S, ElemType e) {
+    SkipTower *update[SKIP_MAX_LEVEL];
+    SkipTower *tower = NULL;
+    LNode *p, *q;
+    ElemType value;
+
+    p = FindPrev_Skip(S, e, update);
+    q = p->next;
+    if (q == NULL || q->data != e) {
+        return ERROR;  // 未找到目标节点
+    }
+
+    // 摘除立在q上的塔
+    for (int l = 0; l < S->level; l++) {
+        SkipTower *next = update[l]->forward[l];
+        if (next == NULL || next->node != q) {
+            break;
+        }
+        update[l]->forward[l] = next->forward[l];
+        tower = next;
+    }
+    free(tower);
+
+    while (S->level > 0 && S->top->forward[S->level - 1] == NULL) {
+        S->level--;
+    }
+
+    S->size--;
+    return DeleteList(p, &value);
+}
+
+Status SearchSkipList(SkipList *S, ElemType e) {
+    LNode *p = FindPrev_Skip(S, e, NULL);
+
+    if (p->next != NULL && p->next->data == e) {
+        return SUCCESS;  // 找到目标节点
+    }
+    return ERROR;  // 未找到目标节点
+}
@@ -0,0 +1,243 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "unrolledList.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ *  @name        : static ULNode* NewNode_UL(void)
+ *	@description : allocate a node with every slot zeroed so that whole-block compares read defined values
+ */
+static ULNode* NewNode_UL(void) {
+    return (ULNode *)calloc(1, sizeof(ULNode));
+}
+
+/**
+ *  @name        : static unsigned MatchMask_UL(const ULNode *node, ElemType e)
+ *	@description : compare all UL_NODE_CAP slots with e, bit k is set when data[k] == e
+ */
+static unsigned MatchMask_UL(const ULNode *node, ElemType e) {
+#if defined(__AVX2__)
+    __m256i key8 = _mm256_set1_epi32(e);
+    __m128i key4 = _mm_set1_epi32(e);
+    __m256i lo = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)&node->data[0]), key8);
+    __m128i hi = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&node->data[8]), key4);
+    return (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(lo))
+         | ((unsigned)_mm_movemask_ps(_mm_castsi128_ps(hi)) << 8);
+#elif defined(__SSE2__)
+    __m128i key = _mm_set1_epi32(e);
+    __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&node->data[0]), key);
+    __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&node->data[4]), key);
+    __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&node->data[8]), key);
+    return (unsigned)_mm_movemask_ps(_mm_castsi128_ps(a))
+         | ((unsigned)_mm_movemask_ps(_mm_castsi128_ps(b)) << 4)
+         | ((unsigned)_mm_movemask_ps(_mm_castsi128_ps(c)) << 8);
+#else
+    unsigned mask = 0;
+    for (int k = 0; k < UL_NODE_CAP; k++) {
+        mask |= (unsigned)(node->data[k] == e) << k;
+    }
+    return mask;
+#endif
+}
+
+Status InitList_UL(UnrolledList *L) {
+    // 头节点的count恒为0，不存放数据
+    *L = NewNode_UL();
+    if (*L == NULL) {
+        return ERROR;  // 内存分配失败
+    }
+    return SUCCESS;
+}
+
+void DestroyList_UL(UnrolledList *L) {
+    UnrolledList temp;
+
+    // 循环释放所有节点内存
+    while (*L != NULL) {
+        temp = *L;
+        *L = (*L)->next;
+        free(temp);
+    }
+}
+
+Status AppendList_UL(ULNode **tail, ElemType e) {
+    ULNode *node = *tail;
+
+    if (node == NULL) {
+        return ERROR;
+    }
+
+    // 尾节点是头节点或已满时新开一个节点
+    if (node->count == 0 || node->count == UL_NODE_CAP) {
+        ULNode *fresh = NewNode_UL();
+        if (fresh == NULL) {
+            return ERROR;  // 内存分配失败
+        }
+        fresh->next = node->next;
+        node->next = fresh;
+        node = fresh;
+        *tail = fresh;
+    }
+
+    node->data[node->count++] = e;
+    return SUCCESS;
+}
+
+Status InsertList_UL(ULNode *p, int i, ElemType e) {
+    if (p == NULL || i < 0) {
+        return ERROR;
+    }
+
+    ULNode *q = p->next;  // 目标节点
+
+    // p是最后一个节点，新建一个节点
+    if (q == NULL) {
+        if (i != 0) {
+            return ERROR;
+        }
+        q = NewNode_UL();
+        if (q == NULL) {
+            return ERROR;  // 内存分配失败
+        }
+        q->data[0] = e;
+        q->count = 1;
+        p->next = q;
+        return SUCCESS;
+    }
+
+    if (i > q->count) {
+        return ERROR;
+    }
+
+    // 节点已满，把后一半元素移到新节点
+    if (q->count == UL_NODE_CAP) {
+        ULNode *r = NewNode_UL();
+        int half = UL_NODE_CAP / 2;
+        if (r == NULL) {
+            return ERROR;  // 内存分配失败
+        }
+        memcpy(r->data, &q->data[half], (UL_NODE_CAP - half) * sizeof(ElemType));
+        memset(&q->data[half], 0, (UL_NODE_CAP - half) * sizeof(ElemType));
+        r->count = UL_NODE_CAP - half;
+        q->count = half;
+        r->next = q->next;
+        q->next = r;
+
+        if (i > half) {
+            q = r;
+            i -= half;
+        }
+    }
+
+    // 后移元素腾出位置
+    memmove(&q->data[i + 1], &q->data[i], (q->count - i) * sizeof(ElemType));
+    q->data[i] = e;
+    q->count++;
+    return SUCCESS;
+}
+
+Status DeleteList_UL(ULNode *p, int i, ElemType *e) {
+    if (p == NULL || p->next == NULL) {
+        return ERROR;  // p为空或p是最后一个节点
+    }
+
+    ULNode *q = p->next;  // 目标节点
+    if (i < 0 || i >= q->count) {
+        return ERROR;
+    }
+
+    *e = q->data[i];
+
+    // 前移元素覆盖被删除的位置
+    memmove(&q->data[i], &q->data[i + 1], (q->count - i - 1) * sizeof(ElemType));
+    q->count--;
+    q->data[q->count] = 0;
+
+    // 节点为空时摘除
+    if (q->count == 0) {
+        p->next = q->next;
+        free(q);
+    }
+    return SUCCESS;
+}
+
+void TraverseList_UL(UnrolledList L, void (*visit)(ElemType e)) {
+    ULNode *current = L->next;  // 从第一个实际节点开始
+
+    // 逐个节点、逐个元素访问
+    while (current != NULL) {
+        for (int k = 0; k < current->count; k++) {
+            visit(current->data[k]);
+        }
+        current = current->next;
+    }
+}
+
+Status SearchList_UL(UnrolledList L, ElemType e) {
+    ULNode *current = L->next;  // 从第一个实际节点开始
+
+    // 一次比较整个节点，再屏蔽掉未使用的槽位
+    while (current != NULL) {
+        if (MatchMask_UL(current, e) & ((1u << current->count) - 1)) {
+            return SUCCESS;  // 找到目标元素
+        }
+        current = current->next;
+    }
+
+    return ERROR;  // 未找到目标元素
+}
+
+Status ReverseList_UL(UnrolledList *L) {
+    if (*L == NULL || (*L)->next == NULL) {
+        return ERROR;  // 空链表
+    }
+
+    ULNode *prev = NULL;
+    ULNode *current = (*L)->next;
+    ULNode *next = NULL;
+
+    // 反转节点顺序，同时反转每个节点内部的元素
+    while (current != NULL) {
+        for (int lo = 0, hi = current->count - 1; lo < hi; lo++, hi--) {
+            ElemType temp = current->data[lo];
+            current->data[lo] = current->data[hi];
+            current->data[hi] = temp;
+        }
+        next = current->next;
+        current->next = prev;
+        prev = current;
+        current = next;
+    }
+
+    (*L)->next = prev;
+    return SUCCESS;
+}
+
+ULNode* FindMidNode_UL(UnrolledList *L, int *index) {
+    ULNode *current;
+    long total = 0, mid;
+
+    *index = 0;
+    if (*L == NULL || (*L)->next == NULL) {
+        return *L;  // 空链表或只有头节点
+    }
+
+    // 先累加各节点的count，再定位第total/2个元素
+    for (current = (*L)->next; current != NULL; current = current->next) {
+        total += current->count;
+    }
+
+    mid = total / 2;
+    current = (*L)->next;
+    while (mid >= current->count) {
+        mid -= current->count;
+        current = current->next;
+    }
+
+    *index = (int)mid;
+    return current;
+}
@@ -0,0 +1,194 @@
+/**
+ * @file compactListTest.c
+ * @brief ListFragmentation and the relayout policy on LNode lists
+ * @note Usage: compactListTest
+ *       A list built in order, from malloc or from a pool, must score below the policy
+ *       threshold, a shuffled one above it. A malloc'd list is then compacted into a pool and
+ *       edited at random through InsertList_Pool/DeleteList_Pool under NoteListMutation, and
+ *       checked against an array after every relayout. Exits 1 on the first failed check.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedList.h"
+#include "nodePool.h"
+#include "compactList.h"
+
+#define NODES 20000
+#define EDIT_NODES 2000
+#define EDITS 100000
+#define THRESHOLD 0.5
+
+static unsigned long long rngState = 0x9E3779B97F4A7C15ull;
+
+/**
+ * @brief xorshift64, uniform in [0, bound)
+ */
+static size_t nextRandom(size_t bound) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (size_t)(rngState % bound);
+}
+
+static int check(int ok, const char *what) {
+    if (!ok) {
+        fprintf(stderr, "failed: %s\n", what);
+    }
+    return ok;
+}
+
+/**
+ * @brief Compare the list with the expected values and check the handle
+ */
+static int sameAs(const PoolList *list, const ElemType *expected, size_t n) {
+    LNode *p = list->head;
+
+    for (size_t i = 0; i < n; i++) {
+        p = p->next;
+        if (p == NULL || p->data != expected[i]) {
+            return 0;
+        }
+    }
+    return p->next == NULL && p == list->tail && list->length == n;
+}
+
+/**
+ * @brief Relink the nodes after the head in a random order
+ */
+static void shuffleLinks(LinkedList L, size_t n) {
+    LNode **nodes = (LNode **)malloc(n * sizeof(LNode *));
+    LNode *p = L->next;
+
+    for (size_t i = 0; i < n; i++, p = p->next) {
+        nodes[i] = p;
+    }
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = nextRandom(i + 1);
+        LNode *temp = nodes[i];
+        nodes[i] = nodes[j];
+        nodes[j] = temp;
+    }
+    L->next = nodes[0];
+    for (size_t i = 0; i + 1 < n; i++) {
+        nodes[i]->next = nodes[i + 1];
+    }
+    nodes[n - 1]->next = NULL;
+    free(nodes);
+}
+
+int main(void) {
+    ElemType *expected = (ElemType *)malloc(NODES * sizeof(ElemType));
+    CompactPolicy policy;
+    NodePool pool;
+    PoolList list;
+    LinkedList L;
+    LNode *tail;
+    size_t n;
+    double f;
+
+    // malloc'd nodes appended in order sit one malloc header apart
+    InitList(&L);
+    tail = L;
+    for (size_t i = 0; i < NODES; i++) {
+        LNode *q = (LNode *)malloc(sizeof(LNode));
+        q->data = (ElemType)i;
+        InsertList(tail, q);
+        tail = q;
+        expected[i] = (ElemType)i;
+    }
+    f = ListFragmentation(L);
+    printf("sequential malloc list: %.3f\n", f);
+    if (!check(f < THRESHOLD, "a list built in order scores below the threshold")) {
+        return 1;
+    }
+
+    shuffleLinks(L, NODES);
+    f = ListFragmentation(L);
+    printf("shuffled malloc list:   %.3f\n", f);
+    if (!check(f > THRESHOLD, "a shuffled list scores above the threshold")) {
+        return 1;
+    }
+
+    // Hand the shuffled malloc'd list to an empty pool, its order must survive
+    n = 0;
+    for (LNode *p = L->next; p != NULL; p = p->next) {
+        expected[n++] = p->data;
+    }
+    InitNodePool(&pool, 0);
+    list.head = L;
+    SyncList_Pool(&list);
+    if (!check(CompactList(&pool, &list) == SUCCESS, "CompactList on a malloc'd list") ||
+        !check(sameAs(&list, expected, NODES), "compaction keeps the order") ||
+        !check(ListFragmentation(list.head) == 0.0, "a compacted list scores 0")) {
+        return 1;
+    }
+    DestroyNodePool(&pool);
+
+    // Appending in order to a pool list never triggers a relayout
+    InitNodePool(&pool, 0);
+    InitList_Pool(&pool, &list);
+    InitCompactPolicy(&policy, THRESHOLD, 0);
+    for (size_t i = 0; i < NODES; i++) {
+        InsertList_Pool(&pool, &list, list.tail, (ElemType)i);
+        NoteListMutation(&policy, &pool, &list);
+    }
+    printf("sequential pool list:   %.3f, %lu relayouts\n", ListFragmentation(list.head),
+           policy.compactions);
+    if (!check(policy.compactions == 0, "appending in order does not relayout")) {
+        return 1;
+    }
+    DestroyNodePool(&pool);
+
+    // Random edits through the pool functions, the policy relays the list out as it scatters
+    InitNodePool(&pool, 64);
+    InitList_Pool(&pool, &list);
+    InitCompactPolicy(&policy, THRESHOLD, 256);
+    n = 0;
+    for (size_t i = 0; i < EDIT_NODES; i++) {
+        InsertList_Pool(&pool, &list, list.tail, (ElemType)i);
+        expected[n++] = (ElemType)i;
+    }
+    for (long k = 0; k < EDITS; k++) {
+        int insert = n == 0 || (n < NODES && nextRandom(2) == 0);
+        size_t at = insert ? nextRandom(n + 1) : nextRandom(n);
+        LNode *p = list.head;
+        ElemType e;
+
+        for (size_t i = 0; i < at; i++) {
+            p = p->next;
+        }
+        if (insert) {
+            InsertList_Pool(&pool, &list, p, (ElemType)k);
+            for (size_t i = n; i > at; i--) {
+                expected[i] = expected[i - 1];
+            }
+            expected[at] = (ElemType)k;
+            n++;
+        } else {
+            DeleteList_Pool(&pool, &list, p, &e);
+            for (size_t i = at; i + 1 < n; i++) {
+                expected[i] = expected[i + 1];
+            }
+            n--;
+        }
+        unsigned long before = policy.compactions;
+        if (!check(NoteListMutation(&policy, &pool, &list) == SUCCESS, "NoteListMutation")) {
+            return 1;
+        }
+        if (policy.compactions != before &&
+            !check(sameAs(&list, expected, n) && pool.live == n + 1, "a relayout keeps every value")) {
+            return 1;
+        }
+    }
+    printf("random edits:           %.3f, %lu relayouts\n", ListFragmentation(list.head),
+           policy.compactions);
+    if (!check(policy.compactions > 0, "random edits trigger a relayout") ||
+        !check(sameAs(&list, expected, n), "the edited list matches")) {
+        return 1;
+    }
+    DestroyNodePool(&pool);
+
+    free(expected);
+    return 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file calcStreamBench.c
+ * @brief Throughput of the streaming evaluator on multi-megabyte expressions
+ * @note Usage: calcStreamBench [megabytes]
+ *       One expression of the given size is written to a temporary file and evaluated from the
+ *       descriptor by evaluateStream, before anything of that size is held in memory, so the
+ *       peak RSS printed after it is the streaming footprint. The same expression is then
+ *       loaded and evaluated from memory by evaluateStream and by isValidExpression +
+ *       calculateExpression.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/resource.h>
+#include "../Include/calculator.h"
+#include "../Include/calcStream.h"
+
+#define DEFAULT_MB 64
+#define PIECE "(12*3+45)-6/2+"
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Peak resident set size of this process in megabytes
+ */
+static double peakRssMB(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / 1024.0;
+}
+
+/**
+ * @brief Write PIECE repeated until about size bytes, closed by a final operand
+ * @return Bytes written, 0 on failure
+ */
+static size_t writeExpression(int fd, size_t size) {
+    char block[65536];
+    size_t pieceLength = strlen(PIECE);
+    size_t perBlock = sizeof(block) / pieceLength;
+    size_t written = 0;
+
+    for (size_t i = 0; i < perBlock; i++) {
+        memcpy(block + i * pieceLength, PIECE, pieceLength);
+    }
+    while (written + perBlock * pieceLength <= size) {
+        if (write(fd, block, perBlock * pieceLength) != (ssize_t)(perBlock * pieceLength)) {
+            return 0;
+        }
+        written += perBlock * pieceLength;
+    }
+    if (write(fd, "1", 1) != 1) {
+        return 0;
+    }
+    return written + 1;
+}
+
+static void report(const char* name, size_t bytes, double seconds, int result) {
+    printf("%-36s %10.1f MB/s  result %11d  peak RSS %8.1f MB\n",
+           name, bytes / seconds / 1e6, result, peakRssMB());
+}
+
+int main(int argc, char* argv[]) {
+    size_t size = (size_t)(argc > 1 ? atol(argv[1]) : DEFAULT_MB) << 20;
+    char path[] = "/tmp/calcStreamBenchXXXXXX";
+    CalcReader reader;
+    CalcStatus status;
+    int result = 0;
+    char* expr;
+    double t;
+
+    int fd = mkstemp(path);
+    if (fd < 0 || (size = writeExpression(fd, size)) == 0) {
+        fprintf(stderr, "cannot write %s\n", path);
+        return 1;
+    }
+    printf("expression of %.1f MB, peak RSS %.1f MB\n", size / 1e6, peakRssMB());
+
+    lseek(fd, 0, SEEK_SET);
+    t = nowSeconds();
+    if (!calcReaderInitFd(&reader, fd)) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    status = evaluateStream(&reader, &result, NULL);
+    calcReaderDestroy(&reader);
+    t = nowSeconds() - t;
+    if (status != CALC_OK) {
+        fprintf(stderr, "evaluateStream: %s\n", calcStatusMessage(status));
+        return 1;
+    }
+    report("evaluateStream (fd)", size, t, result);
+
+    // Load the whole expression for the in-memory runs
+    expr = (char*)malloc(size + 1);
+    if (expr == NULL || pread(fd, expr, size, 0) != (ssize_t)size) {
+        fprintf(stderr, "cannot read %s\n", path);
+        return 1;
+    }
+    expr[size] = '\0';
+    close(fd);
+    unlink(path);
+
+    t = nowSeconds();
+    calcReaderInitBuffer(&reader, expr, size);
+    status = evaluateStream(&reader, &result, NULL);
+    t = nowSeconds() - t;
+    if (status != CALC_OK) {
+        fprintf(stderr, "evaluateStream: %s\n", calcStatusMessage(status));
+        return 1;
+    }
+    report("evaluateStream (buffer)", size, t, result);
+
+    t = nowSeconds();
+    result = isValidExpression(expr) ? calculateExpression(expr) : ERROR_VALUE;
+    t = nowSeconds() - t;
+    report("isValidExpression+calculateExpression", size, t, result);
+
+    free(expr);
+    return 0;
+}
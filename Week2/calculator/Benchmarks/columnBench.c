@@ -0,0 +1,116 @@
+/**
+ * @file columnBench.c
+ * @brief One formula over many rows: text per row, DAG per row, and columnar SIMD
+ * @note Usage: columnBench [rows]
+ *       "text" formats every row into the formula and evaluates the string, as callers did
+ *       before variables existed (evaluateExpression is used instead of calculateExpression
+ *       so error rows do not print), on a sample of the rows. "dag" runs evaluateAstWith
+ *       once per row, "columns" runs evaluateColumns once. Results and error rows of the
+ *       three are checked against each other.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "../Include/calculator.h"
+#include "../Include/calcAst.h"
+#include "../Include/calcColumns.h"
+
+#define DEFAULT_ROWS 4000000L
+#define TEXT_SAMPLE 16      /**< The text mode evaluates one row in TEXT_SAMPLE */
+#define FORMULA "(a*b+c)*(a*b+c) - d/(b-a) + 7*3"
+#define FORMAT_TEXT "(%d*%d+%d)*(%d*%d+%d) - %d/(%d-%d) + 7*3"
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char* argv[]) {
+    long rows = argc > 1 ? atol(argv[1]) : DEFAULT_ROWS;
+    const char* names[] = {"a", "b", "c", "d"};
+    int32_t* columns[4];
+    int32_t* out = (int32_t*)malloc((size_t)rows * sizeof(int32_t));
+    uint8_t* mask = (uint8_t*)malloc((size_t)rows);
+    size_t errorRows = 0;
+    long mismatches = 0;
+    char text[160];
+    CalcAst ast;
+    double t;
+
+    for (int v = 0; v < 4; v++) {
+        columns[v] = (int32_t*)malloc((size_t)rows * sizeof(int32_t));
+        if (columns[v] == NULL) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+    }
+    if (out == NULL || mask == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    // Non-negative readings, a and b collide often enough to exercise the error mask
+    srand(42);
+    for (long r = 0; r < rows; r++) {
+        columns[0][r] = rand() % 64;
+        columns[1][r] = rand() % 64;
+        columns[2][r] = rand() % 1000;
+        columns[3][r] = rand() % 100000;
+    }
+
+    if (compileAstWithVariables(FORMULA, names, 4, &ast) != CALC_OK) {
+        fprintf(stderr, "cannot compile %s\n", FORMULA);
+        return 1;
+    }
+    printf("formula %s, %d DAG nodes, %ld rows\n", FORMULA, ast.count, rows);
+
+    t = nowSeconds();
+    evaluateColumns(&ast, (const int32_t* const*)columns, (size_t)rows, out, mask, &errorRows);
+    t = nowSeconds() - t;
+    printf("%-8s %10.2f Mrows/s  %zu error rows\n", "columns", rows / t / 1e6, errorRows);
+
+    t = nowSeconds();
+    for (long r = 0; r < rows; r++) {
+        int values[4] = {columns[0][r], columns[1][r], columns[2][r], columns[3][r]};
+        int result = 0;
+        CalcStatus status = evaluateAstWith(&ast, values, &result);
+        if ((status != CALC_OK) != (mask[r] != 0) || (status == CALC_OK && result != out[r])) {
+            mismatches++;
+        }
+    }
+    t = nowSeconds() - t;
+    printf("%-8s %10.2f Mrows/s\n", "dag", rows / t / 1e6);
+
+    t = nowSeconds();
+    long sampled = 0;
+    for (long r = 0; r < rows; r += TEXT_SAMPLE) {
+        int a = columns[0][r], b = columns[1][r], c = columns[2][r], d = columns[3][r];
+        int result = 0;
+        snprintf(text, sizeof(text), FORMAT_TEXT, a, b, c, a, b, c, d, b, a);
+        CalcStatus status = evaluateExpression(text, &result, NULL);
+        if ((status != CALC_OK) != (mask[r] != 0) || (status == CALC_OK && result != out[r])) {
+            mismatches++;
+        }
+        sampled++;
+    }
+    t = nowSeconds() - t;
+    printf("%-8s %10.2f Mrows/s\n", "text", sampled / t / 1e6);
+
+    freeAst(&ast);
+    for (int v = 0; v < 4; v++) {
+        free(columns[v]);
+    }
+    free(out);
+    free(mask);
+    if (mismatches != 0) {
+        fprintf(stderr, "%ld rows differ\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
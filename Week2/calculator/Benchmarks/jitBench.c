@@ -0,0 +1,120 @@
+/**
+ * @file jitBench.c
+ * @brief Per-evaluation cost of the JIT, the bytecode interpreter, the DAG and the text evaluator
+ * @note Usage: jitBench [evaluations]
+ *       One formula is evaluated with changing variable values. "jit" is calcJitRun on native
+ *       code, "bytecode" is runProgramWith, "dag" is evaluateAstWith, and "text" formats the
+ *       values into the formula and calls evaluateExpression, the current evaluator, on a
+ *       sample. Checksums of all modes must agree.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../Include/calculator.h"
+#include "../Include/calcBytecode.h"
+#include "../Include/calcAst.h"
+#include "../Include/calcJit.h"
+
+#define DEFAULT_EVALS 20000000L
+#define TEXT_SAMPLE 64      /**< The text mode evaluates one in TEXT_SAMPLE */
+#define FORMULA "(x*3+y)*(x-2*y) + (x+y)/(y+7) - 5*x + 42"
+#define FORMAT_TEXT "(%d*3+%d)*(%d-2*%d) + (%d+%d)/(%d+7) - 5*%d + 42"
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Variable values of evaluation i, kept non-negative so the text form parses the same
+ */
+static void valuesOf(long i, int values[2]) {
+    values[0] = (int)(i % 1000);
+    values[1] = (int)((i * 7) % 500);
+}
+
+static void report(const char* name, long evals, double seconds, long long checksum) {
+    printf("%-9s %9.2f ns/eval  %10.1f Meval/s  checksum %lld\n",
+           name, seconds / evals * 1e9, evals / seconds / 1e6, checksum);
+}
+
+int main(int argc, char* argv[]) {
+    long evals = argc > 1 ? atol(argv[1]) : DEFAULT_EVALS;
+    const char* names[] = {"x", "y"};
+    long long sums[4] = {0, 0, 0, 0};
+    CalcProgram program;
+    CalcAst ast;
+    CalcJit jit;
+    char text[128];
+    int values[2];
+    int result;
+    double t;
+
+    if (calcJitCompile(FORMULA, names, 2, &jit) != CALC_OK ||
+        compileWithVariables(FORMULA, names, 2, &program) != CALC_OK ||
+        compileAstWithVariables(FORMULA, names, 2, &ast) != CALC_OK) {
+        fprintf(stderr, "cannot compile %s\n", FORMULA);
+        return 1;
+    }
+    printf("formula %s, %d instructions, %s\n", FORMULA, program.length,
+           calcJitIsNative(&jit) ? "native code" : "no native code, jit runs interpreted");
+
+    t = nowSeconds();
+    for (long i = 0; i < evals; i++) {
+        valuesOf(i, values);
+        calcJitRun(&jit, values, &result);
+        sums[0] += result;
+    }
+    report("jit", evals, nowSeconds() - t, sums[0]);
+
+    t = nowSeconds();
+    for (long i = 0; i < evals; i++) {
+        valuesOf(i, values);
+        runProgramWith(&program, values, &result);
+        sums[1] += result;
+    }
+    report("bytecode", evals, nowSeconds() - t, sums[1]);
+
+    t = nowSeconds();
+    for (long i = 0; i < evals; i++) {
+        valuesOf(i, values);
+        evaluateAstWith(&ast, values, &result);
+        sums[2] += result;
+    }
+    report("dag", evals, nowSeconds() - t, sums[2]);
+
+    // The text path is sampled, its checksum is compared with the jit on the same sample
+    long long jitSample = 0;
+    long sampled = 0;
+    t = nowSeconds();
+    for (long i = 0; i < evals; i += TEXT_SAMPLE) {
+        int x, y;
+        valuesOf(i, values);
+        x = values[0];
+        y = values[1];
+        snprintf(text, sizeof(text), FORMAT_TEXT, x, y, x, y, x, y, y, x);
+        evaluateExpression(text, &result, NULL);
+        sums[3] += result;
+        sampled++;
+    }
+    report("text", sampled, nowSeconds() - t, sums[3]);
+    for (long i = 0; i < evals; i += TEXT_SAMPLE) {
+        valuesOf(i, values);
+        calcJitRun(&jit, values, &result);
+        jitSample += result;
+    }
+
+    calcJitFree(&jit);
+    freeProgram(&program);
+    freeAst(&ast);
+    if (sums[0] != sums[1] || sums[0] != sums[2] || sums[3] != jitSample) {
+        fprintf(stderr, "checksums differ\n");
+        return 1;
+    }
+    return 0;
+}
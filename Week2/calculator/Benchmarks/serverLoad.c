@@ -0,0 +1,252 @@
+/**
+ * @file serverLoad.c
+ * @brief Load generator for the evaluation server: requests per second and latency percentiles
+ * @note Usage: serverLoad <unix:path|tcp:port> [connections] [depth] [requests]
+ *       Every connection keeps depth expressions in flight, sending a new one for each answer,
+ *       until requests expressions have been answered over all connections. Latency runs from
+ *       the moment a request is handed to the socket to the moment its answer line is read.
+ *       Every answer is checked against evaluateExpression run locally.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../Include/calculator.h"
+#include "../Include/calcServer.h"
+
+#define DEFAULT_CONNECTIONS 4
+#define DEFAULT_DEPTH 32
+#define DEFAULT_REQUESTS 1000000L
+#define MAX_CONNECTIONS 256
+#define ANSWER_LEN 128      /**< Longest answer line */
+
+static const char* const expressions[] = {
+    "(12+34)*(5-6)/7-8*(9+10)",
+    "1+2",
+    "6/-2*3",
+    "((((7))))*((((6))))",
+    "100/(5-5)",
+    "2*(3+4)*(5+6)-(7*8)/(9-1)",
+    "12+*3",
+    "1+2+3+4+5+6+7+8+9+10+11+12+13+14+15+16",
+};
+#define EXPRESSION_COUNT ((int)(sizeof(expressions) / sizeof(expressions[0])))
+
+/**
+ * @brief One client connection and its requests in flight
+ */
+typedef struct {
+    int fd;
+    long issued;          /**< Requests written to the send buffer */
+    long answered;        /**< Answers read */
+    long quota;           /**< Requests this connection sends in total */
+    double* sentAt;       /**< Send time of request i at sentAt[i % depth] */
+    char* send;           /**< Request lines not yet written */
+    size_t sendLength;
+    size_t sendOffset;
+    char receive[65536];  /**< Partial answer line carried between reads */
+    size_t receiveLength;
+} Client;
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int compareDoubles(const void* a, const void* b) {
+    double x = *(const double*)a;
+    double y = *(const double*)b;
+    return x < y ? -1 : x > y;
+}
+
+/**
+ * @brief Answer line the server must give for expression e, without the newline
+ */
+static void expectedAnswer(int e, char* answer) {
+    int result = 0;
+    int errorPos = 0;
+    CalcStatus status = evaluateExpression(expressions[e], &result, &errorPos);
+
+    if (status == CALC_OK) {
+        snprintf(answer, ANSWER_LEN, "%d", result);
+    } else {
+        snprintf(answer, ANSWER_LEN, "error %d %s", errorPos + 1, calcStatusMessage(status));
+    }
+}
+
+/**
+ * @brief Queue requests until depth are in flight, and write what the socket takes
+ * @return false if the connection failed
+ */
+static bool sendRequests(Client* client, int depth) {
+    if (client->sendOffset == client->sendLength) {
+        client->sendLength = 0;
+        client->sendOffset = 0;
+        double now = nowSeconds();
+        while (client->issued < client->quota && client->issued - client->answered < depth) {
+            const char* text = expressions[client->issued % EXPRESSION_COUNT];
+            size_t length = strlen(text);
+            memcpy(client->send + client->sendLength, text, length);
+            client->send[client->sendLength + length] = '\n';
+            client->sendLength += length + 1;
+            client->sentAt[client->issued % depth] = now;
+            client->issued++;
+        }
+    }
+    while (client->sendOffset < client->sendLength) {
+        ssize_t n = write(client->fd, client->send + client->sendOffset,
+                          client->sendLength - client->sendOffset);
+        if (n < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        client->sendOffset += (size_t)n;
+    }
+    return true;
+}
+
+/**
+ * @brief Read answers, record their latency and check them
+ * @return false if the connection failed or closed early
+ */
+static bool receiveAnswers(Client* client, int depth, char answers[][ANSWER_LEN],
+                           double* latencies, long* recorded, long* mismatches) {
+    ssize_t n = read(client->fd, client->receive + client->receiveLength,
+                     sizeof(client->receive) - client->receiveLength);
+    if (n <= 0) {
+        return n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+    }
+    client->receiveLength += (size_t)n;
+
+    double now = nowSeconds();
+    char* line = client->receive;
+    char* end = client->receive + client->receiveLength;
+    char* newline;
+    while ((newline = (char*)memchr(line, '\n', (size_t)(end - line))) != NULL) {
+        long i = client->answered++;
+        *newline = '\0';
+        if (strcmp(line, answers[i % EXPRESSION_COUNT]) != 0) {
+            (*mismatches)++;
+        }
+        latencies[(*recorded)++] = now - client->sentAt[i % depth];
+        line = newline + 1;
+    }
+    client->receiveLength = (size_t)(end - line);
+    memmove(client->receive, line, client->receiveLength);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    int connections = argc > 2 ? atoi(argv[2]) : DEFAULT_CONNECTIONS;
+    int depth = argc > 3 ? atoi(argv[3]) : DEFAULT_DEPTH;
+    long requests = argc > 4 ? atol(argv[4]) : DEFAULT_REQUESTS;
+    char answers[EXPRESSION_COUNT][ANSWER_LEN];
+    struct pollfd polls[MAX_CONNECTIONS];
+    Client* clients;
+    double* latencies;
+    long recorded = 0;
+    long mismatches = 0;
+    size_t longest = 0;
+    int remaining = 0;
+    double t;
+
+    if (argc < 2 || connections < 1 || connections > MAX_CONNECTIONS || depth < 1 || requests < 1) {
+        fprintf(stderr, "usage: serverLoad <unix:path|tcp:port> [connections<=%d] [depth] [requests]\n",
+                MAX_CONNECTIONS);
+        return 1;
+    }
+    for (int e = 0; e < EXPRESSION_COUNT; e++) {
+        expectedAnswer(e, answers[e]);
+        if (strlen(expressions[e]) > longest) {
+            longest = strlen(expressions[e]);
+        }
+    }
+
+    clients = (Client*)calloc((size_t)connections, sizeof(Client));
+    latencies = (double*)malloc((size_t)requests * sizeof(double));
+    if (clients == NULL || latencies == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int c = 0; c < connections; c++) {
+        Client* client = &clients[c];
+        client->quota = requests / connections + (c < requests % connections);
+        client->sentAt = (double*)malloc((size_t)depth * sizeof(double));
+        client->send = (char*)malloc((size_t)depth * (longest + 1));
+        client->fd = calcServerConnect(argv[1]);
+        if (client->sentAt == NULL || client->send == NULL) {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+        if (client->fd < 0) {
+            perror(argv[1]);
+            return 1;
+        }
+        fcntl(client->fd, F_SETFL, fcntl(client->fd, F_GETFL) | O_NONBLOCK);
+    }
+
+    t = nowSeconds();
+    for (int c = 0; c < connections; c++) {
+        sendRequests(&clients[c], depth);
+    }
+    remaining = connections;
+    while (remaining > 0) {
+        for (int c = 0; c < connections; c++) {
+            Client* client = &clients[c];
+            polls[c].fd = client->answered < client->quota ? client->fd : -1;
+            polls[c].events = POLLIN | (client->sendOffset < client->sendLength ? POLLOUT : 0);
+            polls[c].revents = 0;
+        }
+        if (poll(polls, (nfds_t)connections, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            perror("poll");
+            return 1;
+        }
+        for (int c = 0; c < connections; c++) {
+            Client* client = &clients[c];
+            if (polls[c].revents == 0) {
+                continue;
+            }
+            if (((polls[c].revents & (POLLIN | POLLHUP | POLLERR)) &&
+                 !receiveAnswers(client, depth, answers, latencies, &recorded, &mismatches)) ||
+                !sendRequests(client, depth)) {
+                fprintf(stderr, "connection %d failed after %ld answers\n", c, client->answered);
+                return 1;
+            }
+            if (client->answered == client->quota) {
+                remaining--;
+            }
+        }
+    }
+    t = nowSeconds() - t;
+
+    qsort(latencies, (size_t)recorded, sizeof(double), compareDoubles);
+    printf("%ld requests, %d connections, depth %d: %.0f requests/s\n",
+           recorded, connections, depth, recorded / t);
+    printf("latency us: p50 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n",
+           latencies[recorded / 2] * 1e6, latencies[recorded * 99 / 100] * 1e6,
+           latencies[recorded * 999 / 1000] * 1e6, latencies[recorded - 1] * 1e6);
+
+    for (int c = 0; c < connections; c++) {
+        close(clients[c].fd);
+        free(clients[c].sentAt);
+        free(clients[c].send);
+    }
+    free(clients);
+    free(latencies);
+    if (mismatches != 0) {
+        fprintf(stderr, "%ld answers differ\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file calcAst.h
+ * @brief Optional AST path: constant folding and hash-consed common subexpressions
+ * @note The tree is built from the postfix program of compileExpression, so parsing and
+ *       unary minus behave exactly as in calculateExpression. Identical subtrees share one
+ *       node, making the tree a DAG in which every subexpression is evaluated once.
+ *       A division whose divisor folds to zero is left unfolded, so evaluateAst reports
+ *       CALC_ERR_DIV_ZERO just as performOperation would. Variables are leaves that never
+ *       fold, so (a*b+c)*(a*b+c) keeps a single a*b+c node.
+ */
+
+#ifndef CALC_AST_H
+#define CALC_AST_H
+
+#include "calculator.h"
+#include "calcBytecode.h"
+
+/**
+ * @brief One DAG node
+ */
+typedef struct {
+    int op;               /**< BytecodeOp, BC_PUSH for a constant, BC_LOAD for a variable */
+    int value;            /**< Constant value, or variable number */
+    int left;             /**< Index of the left operand */
+    int right;            /**< Index of the right operand */
+} AstNode;
+
+/**
+ * @brief Expression DAG, nodes are stored children first
+ */
+typedef struct {
+    AstNode* nodes;       /**< Live nodes in evaluation order, root last */
+    int count;            /**< Number of nodes */
+} CalcAst;
+
+/**
+ * @brief Build the DAG of a compiled program
+ * @param program Program from compileExpression
+ * @param ast Receives the DAG, free it with freeAst
+ * @return CALC_OK, or CALC_ERR_MEMORY
+ */
+CalcStatus buildAst(const CalcProgram* program, CalcAst* ast);
+
+/**
+ * @brief Parse an expression into a folded DAG
+ * @param expr Expression to compile
+ * @param ast Receives the DAG, free it with freeAst
+ * @return CALC_OK, or the error calculateExpression would have reported while parsing
+ */
+CalcStatus compileAst(const char* expr, CalcAst* ast);
+
+/**
+ * @brief Parse an expression with named variables into a folded DAG
+ * @param expr Expression to compile
+ * @param names Variable names, see compileWithVariables
+ * @param nameCount Number of names
+ * @param ast Receives the DAG, free it with freeAst
+ * @return CALC_OK, or the error compileWithVariables reports
+ */
+CalcStatus compileAstWithVariables(const char* expr, const char* const* names, int nameCount, CalcAst* ast);
+
+/**
+ * @brief Evaluate a DAG, every node once
+ * @param ast DAG to evaluate
+ * @param result Receives the result
+ * @return CALC_OK, or CALC_ERR_DIV_ZERO / CALC_ERR_MEMORY
+ */
+CalcStatus evaluateAst(const CalcAst* ast, int* result);
+
+/**
+ * @brief Evaluate a DAG with variable values, every node once
+ * @param ast DAG to evaluate
+ * @param variables Value of every variable, indexed by variable number
+ * @param result Receives the result
+ * @return CALC_OK, or CALC_ERR_DIV_ZERO / CALC_ERR_MEMORY
+ */
+CalcStatus evaluateAstWith(const CalcAst* ast, const int* variables, int* result);
+
+/**
+ * @brief Free a DAG
+ * @param ast DAG to free
+ */
+void freeAst(CalcAst* ast);
+
+#endif /* CALC_AST_H */
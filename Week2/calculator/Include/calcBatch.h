@@ -0,0 +1,38 @@
+/**
+ * @file calcBatch.h
+ * @brief Non-interactive batch mode: evaluate a file of expressions, one per line, on a worker pool
+ * @note The input file is mapped and cut into line-aligned chunks, one per worker. Every worker
+ *       evaluates its chunk in place with evaluateStream into its own output buffer, and the
+ *       buffers are written in chunk order, so output line n always answers input line n.
+ */
+
+#ifndef CALC_BATCH_H
+#define CALC_BATCH_H
+
+#include "calculator.h"
+
+#define BATCH_MAX_WORKERS 64  /**< Upper bound on worker threads */
+
+/**
+ * @brief Totals of one batch run
+ */
+typedef struct {
+    long lines;           /**< Expressions evaluated */
+    long errors;          /**< Lines that did not evaluate to a number */
+    int workers;          /**< Threads that evaluated chunks, the caller included */
+    double seconds;       /**< Wall time from mapping to the last write */
+} BatchStats;
+
+/**
+ * @brief Evaluate every line of a file
+ * @param inPath File with one expression per line
+ * @param outPath Output file, "-" for standard output
+ * @param workers Number of worker threads, 0 for one per online core
+ * @param stats Receives the totals, may be NULL
+ * @return true if successful, false if a file could not be read or written or memory ran out
+ * @note Every output line is either the result or "error <column> <message>", the column
+ *       being 1-based as in the interactive mode.
+ */
+bool evaluateBatchFile(const char* inPath, const char* outPath, int workers, BatchStats* stats);
+
+#endif /* CALC_BATCH_H */
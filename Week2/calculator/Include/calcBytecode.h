@@ -0,0 +1,134 @@
+/**
+ * @file calcBytecode.h
+ * @brief Compile expressions once into postfix bytecode and evaluate them on a flat operand array
+ * @note Compilation makes the checks of isValidExpression inside the same shunting-yard scan
+ *       as calculateExpression, so a compiled program gives exactly the same result, but the
+ *       text is scanned once and parsing happens once.
+ */
+
+#ifndef CALC_BYTECODE_H
+#define CALC_BYTECODE_H
+
+#include <stdbool.h>
+#include "calculator.h"
+
+#define PROGRAM_CACHE_CAPACITY 256  /**< Default number of cache slots */
+#define RUN_STACK_INLINE 64         /**< Operand depth evaluated without heap allocation */
+
+/**
+ * @brief Bytecode operations
+ */
+typedef enum {
+    BC_PUSH,              /**< Push value */
+    BC_ADD,
+    BC_SUB,
+    BC_MUL,
+    BC_DIV,
+    BC_LOAD               /**< Push variable number value */
+} BytecodeOp;
+
+/**
+ * @brief One bytecode instruction
+ */
+typedef struct {
+    int op;               /**< BytecodeOp */
+    int value;            /**< Operand of BC_PUSH, variable number of BC_LOAD */
+} BytecodeInstr;
+
+/**
+ * @brief Compiled expression
+ */
+typedef struct {
+    BytecodeInstr* code;  /**< Instructions in postfix order */
+    int length;           /**< Number of instructions */
+    int maxDepth;         /**< Largest operand depth reached while running */
+} CalcProgram;
+
+/**
+ * @brief One cache slot, text == NULL means empty
+ */
+typedef struct {
+    char* text;           /**< Expression text, owned by the cache */
+    unsigned hash;        /**< Hash of text */
+    CalcStatus status;    /**< Compile status, failures are cached too */
+    CalcProgram program;  /**< Compiled program when status is CALC_OK */
+} ProgramCacheEntry;
+
+/**
+ * @brief Compiled-program cache keyed by expression text, open addressing
+ * @note The cache is flushed when it becomes half full, which keeps probing short
+ *       for the handful of formulas a workload repeats.
+ */
+typedef struct {
+    ProgramCacheEntry* entries;
+    int capacity;         /**< Power of two */
+    int count;
+    long hits;
+    long misses;
+} ProgramCache;
+
+/**
+ * @brief Compile an expression into bytecode
+ * @param expr Expression to compile
+ * @param program Receives the compiled program, free it with freeProgram
+ * @return CALC_OK, or the error calculateExpression would have reported
+ */
+CalcStatus compileExpression(const char* expr, CalcProgram* program);
+
+/**
+ * @brief Compile an expression that may refer to named variables
+ * @param expr Expression to compile, names are letters, digits and '_' not starting with a digit
+ * @param names Variable names, the position of a name is its variable number
+ * @param nameCount Number of names
+ * @param program Receives the compiled program, free it with freeProgram
+ * @return CALC_OK, CALC_ERR_VARIABLE for a name not in names, or a syntax or format error
+ */
+CalcStatus compileWithVariables(const char* expr, const char* const* names, int nameCount, CalcProgram* program);
+
+/**
+ * @brief Run a compiled program
+ * @param program Program to run
+ * @param result Receives the result
+ * @return CALC_OK, or CALC_ERR_DIV_ZERO / CALC_ERR_MEMORY
+ */
+CalcStatus runProgram(const CalcProgram* program, int* result);
+
+/**
+ * @brief Run a compiled program with variable values
+ * @param program Program to run
+ * @param variables Value of every variable, indexed by variable number
+ * @param result Receives the result
+ * @return CALC_OK, or CALC_ERR_DIV_ZERO / CALC_ERR_MEMORY
+ */
+CalcStatus runProgramWith(const CalcProgram* program, const int* variables, int* result);
+
+/**
+ * @brief Free a compiled program
+ * @param program Program to free
+ */
+void freeProgram(CalcProgram* program);
+
+/**
+ * @brief Initialize a program cache
+ * @param cache Cache to initialize
+ * @param capacity Number of slots, rounded up to a power of two
+ * @return true if successful, false otherwise
+ */
+bool programCacheInit(ProgramCache* cache, int capacity);
+
+/**
+ * @brief Free every cached program
+ * @param cache Cache to destroy
+ */
+void programCacheDestroy(ProgramCache* cache);
+
+/**
+ * @brief Evaluate an expression, compiling it only the first time its text is seen
+ * @param cache Program cache
+ * @param expr Expression to evaluate
+ * @param result Receives the result
+ * @return CALC_OK or an error status
+ */
+CalcStatus evaluateCached(ProgramCache* cache, const char* expr, int* result);
+
+#endif /* CALC_BYTECODE_H */
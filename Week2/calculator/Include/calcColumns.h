@@ -0,0 +1,36 @@
+/**
+ * @file calcColumns.h
+ * @brief Columnar evaluation of one expression over arrays of int32 variable bindings
+ * @note The expression is compiled once into a DAG (see calcAst.h). Rows are then processed in
+ *       blocks of CALC_COLUMN_BLOCK: every DAG node becomes one block-sized vector, computed
+ *       with SIMD kernels for + - * and a checked scalar loop for /. Variables are read from
+ *       the caller's columns in place.
+ */
+
+#ifndef CALC_COLUMNS_H
+#define CALC_COLUMNS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "calculator.h"
+#include "calcAst.h"
+
+#define CALC_COLUMN_BLOCK 512  /**< Rows per block, small enough for the node vectors to stay in cache */
+
+/**
+ * @brief Evaluate a DAG for every row
+ * @param ast DAG from compileAstWithVariables
+ * @param columns columns[v][row] is the value of variable number v in that row
+ * @param rows Number of rows
+ * @param out Receives one result per row, 0 for rows in error
+ * @param errorMask Receives 1 for every row that divides by zero, 0 otherwise
+ * @param errorRows Receives the number of rows in error, may be NULL
+ * @return CALC_OK, or CALC_ERR_MEMORY
+ * @note A row is in error exactly when evaluateAstWith on that row's values returns
+ *       CALC_ERR_DIV_ZERO, and every other row gets the same result. Arithmetic wraps on
+ *       overflow, and INT32_MIN / -1 gives INT32_MIN instead of trapping.
+ */
+CalcStatus evaluateColumns(const CalcAst* ast, const int32_t* const* columns, size_t rows,
+                           int32_t* out, uint8_t* errorMask, size_t* errorRows);
+
+#endif /* CALC_COLUMNS_H */
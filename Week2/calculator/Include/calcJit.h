@@ -0,0 +1,68 @@
+/**
+ * @file calcJit.h
+ * @brief Optional native code backend for hot expressions, Linux x86-64 only
+ * @note The postfix program is translated into machine code in an mmap'd buffer that is
+ *       made executable once written. The top of the operand stack lives in eax and the
+ *       rest on the machine stack; an operator whose right operand is a constant or a
+ *       variable uses it directly as an immediate or memory operand. Division checks its
+ *       divisor and returns CALC_ERR_DIV_ZERO like runProgram. On other targets, or if the
+ *       buffer cannot be mapped, the program is run by the bytecode interpreter instead.
+ */
+
+#ifndef CALC_JIT_H
+#define CALC_JIT_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "calculator.h"
+#include "calcBytecode.h"
+
+#if defined(__x86_64__) && defined(__linux__)
+#define CALC_JIT_NATIVE 1  /**< Native code generation is compiled in */
+#else
+#define CALC_JIT_NATIVE 0
+#endif
+
+/**
+ * @brief Compiled expression, native or interpreted
+ */
+typedef struct {
+    void* code;           /**< Executable buffer, NULL when interpreted */
+    size_t size;          /**< Mapped size of code */
+    CalcProgram program;  /**< Bytecode, kept for the interpreter */
+} CalcJit;
+
+/**
+ * @brief Compile an expression to native code
+ * @param expr Expression to compile
+ * @param names Variable names, see compileWithVariables, may be NULL
+ * @param nameCount Number of names
+ * @param jit Receives the compiled expression, free it with calcJitFree
+ * @return CALC_OK, or the error compileWithVariables reports
+ * @note Success does not guarantee native code, see calcJitIsNative
+ */
+CalcStatus calcJitCompile(const char* expr, const char* const* names, int nameCount, CalcJit* jit);
+
+/**
+ * @brief Check whether an expression runs as native code
+ * @param jit Compiled expression
+ * @return true if native, false if it falls back to the interpreter
+ */
+bool calcJitIsNative(const CalcJit* jit);
+
+/**
+ * @brief Evaluate a compiled expression
+ * @param jit Compiled expression
+ * @param variables Value of every variable, may be NULL without variables
+ * @param result Receives the result
+ * @return CALC_OK, or CALC_ERR_DIV_ZERO / CALC_ERR_MEMORY
+ */
+CalcStatus calcJitRun(const CalcJit* jit, const int* variables, int* result);
+
+/**
+ * @brief Unmap the native code and free the program
+ * @param jit Compiled expression
+ */
+void calcJitFree(CalcJit* jit);
+
+#endif /* CALC_JIT_H */
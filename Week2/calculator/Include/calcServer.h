@@ -0,0 +1,66 @@
+/**
+ * @file calcServer.h
+ * @brief Evaluation server: newline-delimited expressions over a local socket, epoll multiplexed
+ * @note One thread serves every connection. A client may send any number of expressions
+ *       without waiting; each complete line is evaluated with evaluateStream as soon as it
+ *       arrives and answered in order, in the batch format: the result, or
+ *       "error <column> <message>". The input and output buffers of a connection are kept
+ *       and reused for its whole life, and the evaluator's stacks are the inline ones of
+ *       LinkedStack, so a request allocates nothing once the connection is warm. A client
+ *       that stops reading its answers is no longer read from until it catches up.
+ */
+
+#ifndef CALC_SERVER_H
+#define CALC_SERVER_H
+
+#include <signal.h>
+#include <stdbool.h>
+#include "calculator.h"
+
+#define CALC_SERVER_MAX_LINE (1 << 20)      /**< Longest expression, longer lines close the connection */
+#define CALC_SERVER_MAX_PENDING (1 << 20)   /**< Unsent answer bytes at which reading pauses */
+
+/**
+ * @brief Totals of one server run
+ */
+typedef struct {
+    long connections;     /**< Connections accepted */
+    long requests;        /**< Expressions answered */
+    long errors;          /**< Answers that were errors */
+} ServerStats;
+
+/**
+ * @brief Open a listening socket
+ * @param address "unix:<path>" for a UNIX-domain socket, or "tcp:<port>" for 127.0.0.1
+ * @return Non-blocking listening descriptor, or -1 on error with errno set
+ * @note A stale socket file at path is removed first
+ */
+int calcServerListen(const char* address);
+
+/**
+ * @brief Serve clients until stop becomes non-zero
+ * @param listenFd Descriptor from calcServerListen
+ * @param stop Flag set from a SIGINT or SIGTERM handler, the handler must not use SA_RESTART
+ * @param stats Receives the totals, may be NULL
+ * @return true on a requested stop, false if epoll failed
+ * @note Open connections are closed on return, listenFd is not. SIGINT and SIGTERM are blocked
+ *       in the calling thread while serving, except inside epoll_pwait, so a stop signal is
+ *       never lost between the check of stop and the wait
+ */
+bool calcServerRun(int listenFd, volatile sig_atomic_t* stop, ServerStats* stats);
+
+/**
+ * @brief Close a listening socket and remove its socket file
+ * @param listenFd Descriptor from calcServerListen
+ * @param address Address it was opened with
+ */
+void calcServerClose(int listenFd, const char* address);
+
+/**
+ * @brief Connect to a server, for clients
+ * @param address Same format as calcServerListen
+ * @return Blocking connected descriptor, or -1 on error with errno set
+ */
+int calcServerConnect(const char* address);
+
+#endif /* CALC_SERVER_H */
@@ -0,0 +1,120 @@
+/**
+ * @file calcStream.h
+ * @brief Streaming tokenizer and evaluator: expressions of any length in bounded memory
+ * @note Input is consumed through a fixed-size window, so beyond the operand and operator
+ *       stacks the memory used does not depend on the length of the expression. The
+ *       evaluator performs the same checks and gives the same results as evaluateExpression,
+ *       which is itself a thin wrapper over it.
+ */
+
+#ifndef CALC_STREAM_H
+#define CALC_STREAM_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "calculator.h"
+
+#define CALC_STREAM_WINDOW 65536  /**< Bytes read from a file or descriptor at a time */
+
+/**
+ * @brief Token kinds
+ */
+typedef enum {
+    CALC_TOKEN_NUMBER,    /**< Non-negative integer literal */
+    CALC_TOKEN_OPERATOR,  /**< + - * / */
+    CALC_TOKEN_LPAREN,
+    CALC_TOKEN_RPAREN,
+    CALC_TOKEN_INVALID,   /**< Any other character */
+    CALC_TOKEN_END        /**< End of the expression: newline or end of input */
+} CalcTokenType;
+
+/**
+ * @brief One token
+ */
+typedef struct {
+    CalcTokenType type;
+    int value;            /**< Number value, or the character for the other kinds */
+    long long position;   /**< Offset from the start of the expression */
+} CalcToken;
+
+/**
+ * @brief Input source feeding the tokenizer
+ */
+typedef struct {
+    const char* data;     /**< Current window */
+    size_t length;        /**< Bytes in the window */
+    size_t pos;           /**< Next byte to read in the window */
+    long long consumed;   /**< Input offset of data[0] */
+    long long lineStart;  /**< Input offset where the current expression began */
+    int fd;               /**< Descriptor, -1 if not reading from one */
+    FILE* file;           /**< Stream, NULL if not reading from one */
+    char* window;         /**< Owned window storage for fd and FILE sources */
+    bool stopAtNewline;   /**< A newline ends the expression, otherwise it is whitespace */
+    bool failed;          /**< A read error happened */
+} CalcReader;
+
+/**
+ * @brief Read expressions from memory, no copy is made
+ * @param reader Reader to initialize
+ * @param data Input, does not need to be NUL-terminated
+ * @param length Bytes of input
+ */
+void calcReaderInitBuffer(CalcReader* reader, const char* data, size_t length);
+
+/**
+ * @brief Read expressions from a file descriptor
+ * @param reader Reader to initialize
+ * @param fd Descriptor, left open by calcReaderDestroy
+ * @return true if successful, false if the window could not be allocated
+ */
+bool calcReaderInitFd(CalcReader* reader, int fd);
+
+/**
+ * @brief Read expressions from a stdio stream, one line per read so terminals do not block
+ * @param reader Reader to initialize
+ * @param file Stream, left open by calcReaderDestroy
+ * @param prefix Bytes already taken from the stream that belong in front of it, may be NULL
+ * @param prefixLength Length of prefix, at most CALC_STREAM_WINDOW
+ * @return true if successful, false if the window could not be allocated
+ */
+bool calcReaderInitFile(CalcReader* reader, FILE* file, const char* prefix, size_t prefixLength);
+
+/**
+ * @brief Free the window of a reader
+ * @param reader Reader to destroy
+ */
+void calcReaderDestroy(CalcReader* reader);
+
+/**
+ * @brief Check whether all input has been consumed
+ * @param reader Reader
+ * @return true if nothing is left to read
+ */
+bool calcReaderAtEnd(CalcReader* reader);
+
+/**
+ * @brief Read the next token of the current expression
+ * @param reader Reader
+ * @param token Receives the token, CALC_TOKEN_END is returned again until calcReaderNextLine
+ */
+void calcNextToken(CalcReader* reader, CalcToken* token);
+
+/**
+ * @brief Skip the rest of the current expression, including its newline
+ * @param reader Reader
+ */
+void calcReaderNextLine(CalcReader* reader);
+
+/**
+ * @brief Validate and evaluate the next expression in a single scan
+ * @param reader Reader positioned at the start of an expression
+ * @param result Receives the result
+ * @param errorPos Receives the offset in the expression where the error was found, may be NULL
+ * @return CALC_OK or an error status, never prints
+ * @note The whole expression, up to and including its newline, is consumed even on error,
+ *       so the next call starts on the next line.
+ */
+CalcStatus evaluateStream(CalcReader* reader, int* result, long long* errorPos);
+
+#endif /* CALC_STREAM_H */
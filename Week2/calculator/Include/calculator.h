@@ -0,0 +1,84 @@
+/**
+ * @file calculator.h
+ * @brief Integer expression calculator based on linked stack
+ * @note Supports integers, operations (+,-,*,/), and parentheses
+ */
+
+#ifndef CALCULATOR_H
+#define CALCULATOR_H
+
+#include <stdbool.h>
+#include "../../linkedStack/Include/linkedStack.h"
+
+#define ERROR_VALUE -999999  /**< Error value identifier */
+
+/**
+ * @brief Result of validating, compiling or evaluating an expression
+ */
+typedef enum {
+    CALC_OK = 0,          /**< Success */
+    CALC_ERR_SYNTAX,      /**< Rejected by isValidExpression */
+    CALC_ERR_PAREN,       /**< Mismatched parentheses */
+    CALC_ERR_OPERAND,     /**< Operator missing operands */
+    CALC_ERR_FORMAT,      /**< Invalid expression format */
+    CALC_ERR_DIV_ZERO,    /**< Division by zero */
+    CALC_ERR_MEMORY,      /**< Out of memory */
+    CALC_ERR_VARIABLE     /**< Unknown variable name */
+} CalcStatus;
+
+/**
+ * @brief Validate expression format
+ * @param expr Expression to validate
+ * @return true if expression format is correct, false otherwise
+ */
+bool isValidExpression(const char* expr);
+
+/**
+ * @brief Calculate expression value
+ * @param expr Expression to calculate
+ * @return Calculated result, ERROR_VALUE if calculation error
+ */
+int calculateExpression(const char* expr);
+
+/**
+ * @brief Validate and evaluate an expression in a single scan
+ * @param expr Expression to evaluate
+ * @param result Receives the result
+ * @param errorPos Receives the index in expr where the error was found, may be NULL
+ * @return CALC_OK or an error status, never prints
+ * @note Detects the same errors as isValidExpression followed by calculateExpression.
+ *       A runtime error stops evaluation but the scan goes on, so a syntax error
+ *       later in the line is still the one reported, as with the two-pass path.
+ */
+CalcStatus evaluateExpression(const char* expr, int* result, int* errorPos);
+
+/**
+ * @brief Determine if character is an operator
+ * @param ch Character to check
+ * @return true if character is an operator, false otherwise
+ */
+bool isOperator(char ch);
+
+/**
+ * @brief Get operator priority
+ * @param op Operator
+ * @return Priority value, higher value means higher priority
+ */
+int getPriority(char op);
+
+/**
+ * @brief Execute operation
+ * @param numStack Number stack
+ * @param opStack Operator stack
+ * @return true if operation successful, false otherwise
+ */
+bool performOperation(LinkedStack* numStack, LinkedStack* opStack);
+
+/**
+ * @brief Describe a status
+ * @param status Status to describe
+ * @return Message in the wording calculateExpression prints
+ */
+const char* calcStatusMessage(CalcStatus status);
+
+#endif /* CALCULATOR_H */
@@ -0,0 +1,292 @@
+/**
+ * @file calcAst.c
+ * @brief DAG construction with constant folding and hash-consing, and its evaluator
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "calculator.h"
+#include "calcBytecode.h"
+#include "calcAst.h"
+
+#define EVAL_INLINE 64    /**< Nodes evaluated without heap allocation */
+
+/**
+ * @brief Node arena plus the hash-cons table, only alive while building
+ */
+typedef struct {
+    AstNode* nodes;
+    int count;
+    int capacity;
+    int* table;           /**< Node indices, -1 means empty */
+    int tableCapacity;    /**< Power of two, kept at most half full */
+} AstBuilder;
+
+/**
+ * @brief Constants and variables have no operands
+ */
+static inline bool isLeaf(int op) {
+    return op == BC_PUSH || op == BC_LOAD;
+}
+
+/**
+ * @brief Hash of a node's contents
+ */
+static unsigned hashNode(int op, int value, int left, int right) {
+    unsigned hash = 2166136261u;
+
+    hash = (hash ^ (unsigned)op) * 16777619u;
+    hash = (hash ^ (unsigned)value) * 16777619u;
+    hash = (hash ^ (unsigned)left) * 16777619u;
+    hash = (hash ^ (unsigned)right) * 16777619u;
+    return hash ^ (hash >> 15);
+}
+
+/**
+ * @brief Double the hash-cons table and reinsert every node
+ */
+static bool growTable(AstBuilder* b) {
+    int capacity = b->tableCapacity == 0 ? 64 : b->tableCapacity * 2;
+    int* table = (int*)malloc((size_t)capacity * sizeof(int));
+    if (table == NULL) {
+        return false;
+    }
+    memset(table, -1, (size_t)capacity * sizeof(int));
+
+    for (int i = 0; i < b->count; i++) {
+        const AstNode* n = &b->nodes[i];
+        unsigned slot = hashNode(n->op, n->value, n->left, n->right) & (unsigned)(capacity - 1);
+        while (table[slot] != -1) {
+            slot = (slot + 1) & (unsigned)(capacity - 1);
+        }
+        table[slot] = i;
+    }
+
+    free(b->table);
+    b->table = table;
+    b->tableCapacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Return the node with these contents, creating it if it does not exist yet
+ * @return Node index, -1 if out of memory
+ */
+static int internNode(AstBuilder* b, int op, int value, int left, int right) {
+    if (2 * (b->count + 1) > b->tableCapacity && !growTable(b)) {
+        return -1;
+    }
+
+    unsigned mask = (unsigned)(b->tableCapacity - 1);
+    unsigned slot = hashNode(op, value, left, right) & mask;
+    while (b->table[slot] != -1) {
+        const AstNode* n = &b->nodes[b->table[slot]];
+        if (n->op == op && n->value == value && n->left == left && n->right == right) {
+            return b->table[slot];  // Identical subexpression already built
+        }
+        slot = (slot + 1) & mask;
+    }
+
+    if (b->count == b->capacity) {
+        int capacity = b->capacity == 0 ? 16 : b->capacity * 2;
+        AstNode* nodes = (AstNode*)realloc(b->nodes, (size_t)capacity * sizeof(AstNode));
+        if (nodes == NULL) {
+            return -1;
+        }
+        b->nodes = nodes;
+        b->capacity = capacity;
+    }
+
+    b->nodes[b->count] = (AstNode){op, value, left, right};
+    b->table[slot] = b->count;
+    return b->count++;
+}
+
+/**
+ * @brief Build a binary node, folding it when both operands are constants
+ * @return Node index, -1 if out of memory
+ */
+static int makeBinary(AstBuilder* b, int op, int left, int right) {
+    const AstNode* l = &b->nodes[left];
+    const AstNode* r = &b->nodes[right];
+
+    // Division by a constant zero stays in the tree so evaluation reports it
+    if (l->op == BC_PUSH && r->op == BC_PUSH && !(op == BC_DIV && r->value == 0)) {
+        int value;
+        switch (op) {
+            case BC_ADD:
+                value = l->value + r->value;
+                break;
+            case BC_SUB:
+                value = l->value - r->value;
+                break;
+            case BC_MUL:
+                value = l->value * r->value;
+                break;
+            default:
+                // INT_MIN / -1 would trap while compiling, negate with wraparound instead
+                value = r->value == -1 ? (int)(0u - (unsigned)l->value) : l->value / r->value;
+                break;
+        }
+        return internNode(b, BC_PUSH, value, -1, -1);
+    }
+    return internNode(b, op, 0, left, right);
+}
+
+/**
+ * @brief Keep only the nodes reachable from root, preserving their order
+ */
+static CalcStatus compact(AstBuilder* b, int root, CalcAst* ast) {
+    int* remap = (int*)malloc((size_t)(root + 1) * sizeof(int));
+    int count = 0;
+
+    if (remap == NULL) {
+        return CALC_ERR_MEMORY;
+    }
+
+    // Children always precede their parent, so one backward sweep marks everything reachable
+    for (int i = 0; i <= root; i++) {
+        remap[i] = -1;
+    }
+    remap[root] = 0;
+    for (int i = root; i >= 0; i--) {
+        if (remap[i] != -1 && !isLeaf(b->nodes[i].op)) {
+            remap[b->nodes[i].left] = 0;
+            remap[b->nodes[i].right] = 0;
+        }
+    }
+
+    for (int i = 0; i <= root; i++) {
+        if (remap[i] == -1) {
+            continue;
+        }
+        AstNode n = b->nodes[i];
+        if (!isLeaf(n.op)) {
+            n.left = remap[n.left];
+            n.right = remap[n.right];
+        }
+        remap[i] = count;
+        b->nodes[count++] = n;
+    }
+    free(remap);
+
+    ast->nodes = b->nodes;
+    ast->count = count;
+    b->nodes = NULL;
+    return CALC_OK;
+}
+
+CalcStatus buildAst(const CalcProgram* program, CalcAst* ast) {
+    AstBuilder b = {NULL, 0, 0, NULL, 0};
+    int* stack = (int*)malloc((size_t)program->maxDepth * sizeof(int));
+    CalcStatus status = CALC_OK;
+    int top = -1;
+
+    if (stack == NULL) {
+        return CALC_ERR_MEMORY;
+    }
+
+    // The postfix program already has every operand where the shunting-yard put it
+    for (int pc = 0; pc < program->length && status == CALC_OK; pc++) {
+        const BytecodeInstr* in = &program->code[pc];
+        int node;
+        if (isLeaf(in->op)) {
+            node = internNode(&b, in->op, in->value, -1, -1);
+        } else {
+            int right = stack[top--];
+            int left = stack[top--];
+            node = makeBinary(&b, in->op, left, right);
+        }
+        if (node < 0) {
+            status = CALC_ERR_MEMORY;
+        } else {
+            stack[++top] = node;
+        }
+    }
+
+    if (status == CALC_OK) {
+        status = compact(&b, stack[0], ast);
+    }
+    free(stack);
+    free(b.table);
+    free(b.nodes);
+    return status;
+}
+
+CalcStatus compileAst(const char* expr, CalcAst* ast) {
+    return compileAstWithVariables(expr, NULL, 0, ast);
+}
+
+CalcStatus compileAstWithVariables(const char* expr, const char* const* names, int nameCount, CalcAst* ast) {
+    CalcProgram program;
+    CalcStatus status = compileWithVariables(expr, names, nameCount, &program);
+
+    if (status != CALC_OK) {
+        return status;
+    }
+    status = buildAst(&program, ast);
+    freeProgram(&program);
+    return status;
+}
+
+CalcStatus evaluateAst(const CalcAst* ast, int* result) {
+    return evaluateAstWith(ast, NULL, result);
+}
+
+CalcStatus evaluateAstWith(const CalcAst* ast, const int* variables, int* result) {
+    int inlineValues[EVAL_INLINE];
+    int* values = inlineValues;
+    CalcStatus status = CALC_OK;
+
+    if (ast->count > EVAL_INLINE) {
+        values = (int*)malloc((size_t)ast->count * sizeof(int));
+        if (values == NULL) {
+            return CALC_ERR_MEMORY;
+        }
+    }
+
+    // Nodes are stored children first, so one forward pass evaluates each exactly once
+    for (int i = 0; i < ast->count; i++) {
+        const AstNode* n = &ast->nodes[i];
+        switch (n->op) {
+            case BC_PUSH:
+                values[i] = n->value;
+                break;
+            case BC_LOAD:
+                values[i] = variables[n->value];
+                break;
+            case BC_ADD:
+                values[i] = values[n->left] + values[n->right];
+                break;
+            case BC_SUB:
+                values[i] = values[n->left] - values[n->right];
+                break;
+            case BC_MUL:
+                values[i] = values[n->left] * values[n->right];
+                break;
+            default:
+                if (values[n->right] == 0) {
+                    status = CALC_ERR_DIV_ZERO;
+                    i = ast->count;
+                    break;
+                }
+                values[i] = values[n->right] == -1 ? (int)(0u - (unsigned)values[n->left])
+                                                   : values[n->left] / values[n->right];
+                break;
+        }
+    }
+
+    if (status == CALC_OK) {
+        *result = values[ast->count - 1];
+    }
+    if (values != inlineValues) {
+        free(values);
+    }
+    return status;
+}
+
+void freeAst(CalcAst* ast) {
+    free(ast->nodes);
+    ast->nodes = NULL;
+    ast->count = 0;
+}
@@ -0,0 +1,235 @@
+/**
+ * @file calcBatch.c
+ * @brief Batch evaluation of mapped expression files on a worker pool
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "calculator.h"
+#include "calcStream.h"
+#include "calcBatch.h"
+
+/**
+ * @brief Growable byte buffer
+ */
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+} ByteBuffer;
+
+/**
+ * @brief One worker's share of the input and its private output
+ */
+typedef struct {
+    const char* begin;    /**< First byte of the chunk */
+    const char* end;      /**< One past the last byte, always just after a newline or at EOF */
+    ByteBuffer out;       /**< Results of this chunk */
+    long lines;
+    long errors;
+    bool failed;          /**< Out of memory */
+} BatchChunk;
+
+/**
+ * @brief Make room for extra more bytes
+ */
+static bool reserve(ByteBuffer* buffer, size_t extra) {
+    if (buffer->length + extra <= buffer->capacity) {
+        return true;
+    }
+
+    size_t capacity = buffer->capacity == 0 ? 4096 : buffer->capacity;
+    while (capacity < buffer->length + extra) {
+        capacity *= 2;
+    }
+    char* data = (char*)realloc(buffer->data, capacity);
+    if (data == NULL) {
+        return false;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Append the answer of one expression
+ */
+static bool appendAnswer(BatchChunk* chunk, CalcStatus status, int result, long long errorPos) {
+    int written;
+
+    // A status message is well under 128 bytes
+    if (!reserve(&chunk->out, 128)) {
+        return false;
+    }
+    if (status == CALC_OK) {
+        written = snprintf(chunk->out.data + chunk->out.length, 128, "%d\n", result);
+    } else {
+        chunk->errors++;
+        written = snprintf(chunk->out.data + chunk->out.length, 128, "error %lld %s\n",
+                           errorPos + 1, calcStatusMessage(status));
+    }
+    chunk->out.length += (size_t)written;
+    return true;
+}
+
+/**
+ * @brief Worker thread: evaluate every line of one chunk, straight from the mapping
+ */
+static void* batchWorker(void* arg) {
+    BatchChunk* chunk = (BatchChunk*)arg;
+    CalcReader reader;
+
+    calcReaderInitBuffer(&reader, chunk->begin, (size_t)(chunk->end - chunk->begin));
+    while (!calcReaderAtEnd(&reader)) {
+        int result = 0;
+        long long errorPos = 0;
+        CalcStatus status = evaluateStream(&reader, &result, &errorPos);
+        chunk->lines++;
+        if (!appendAnswer(chunk, status, result, errorPos)) {
+            chunk->failed = true;
+            break;
+        }
+    }
+
+    // Return the nodes this thread cached while evaluating
+    LinkedStack empty;
+    stackInit(&empty);
+    stackShrink(&empty);
+    return NULL;
+}
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+bool evaluateBatchFile(const char* inPath, const char* outPath, int workers, BatchStats* stats) {
+    BatchChunk chunks[BATCH_MAX_WORKERS];
+    pthread_t tids[BATCH_MAX_WORKERS];
+    double start = nowSeconds();
+    const char* text = NULL;
+    size_t size = 0;
+    struct stat st;
+    bool ok = true;
+    FILE* out;
+    int fd;
+
+    fd = open(inPath, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+    size = (size_t)st.st_size;
+    if (size > 0) {
+        void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        madvise(map, size, MADV_SEQUENTIAL);
+        text = (const char*)map;
+    }
+    close(fd);
+
+    if (workers <= 0) {
+        workers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    }
+    if (workers < 1) {
+        workers = 1;
+    }
+    if (workers > BATCH_MAX_WORKERS) {
+        workers = BATCH_MAX_WORKERS;
+    }
+    // Small files are not worth a thread per core
+    if ((size_t)workers > size / 4096 + 1) {
+        workers = (int)(size / 4096 + 1);
+    }
+
+    // Cut at roughly equal offsets, then move each cut to just after the next newline
+    const char* cut = text;
+    for (int w = 0; w < workers; w++) {
+        const char* end = text + size;
+        if (w < workers - 1) {
+            const char* guess = text + size / (size_t)workers * (size_t)(w + 1);
+            if (guess < cut) {
+                guess = cut;
+            }
+            const char* newline = (const char*)memchr(guess, '\n', (size_t)(end - guess));
+            if (newline != NULL) {
+                end = newline + 1;
+            }
+        }
+        memset(&chunks[w], 0, sizeof(chunks[w]));
+        chunks[w].begin = cut;
+        chunks[w].end = end;
+        cut = end;
+    }
+
+    int started = 0;
+    for (int w = 1; w < workers; w++) {
+        if (pthread_create(&tids[w], NULL, batchWorker, &chunks[w]) != 0) {
+            break;
+        }
+        started = w;
+    }
+    // The calling thread takes the first chunk, and any chunk whose thread did not start
+    batchWorker(&chunks[0]);
+    for (int w = started + 1; w < workers; w++) {
+        batchWorker(&chunks[w]);
+    }
+    for (int w = 1; w <= started; w++) {
+        pthread_join(tids[w], NULL);
+    }
+
+    out = strcmp(outPath, "-") == 0 ? stdout : fopen(outPath, "w");
+    if (out == NULL) {
+        ok = false;
+    }
+
+    if (stats != NULL) {
+        stats->lines = 0;
+        stats->errors = 0;
+        stats->workers = started + 1;  // The calling thread plus every worker that started
+    }
+    for (int w = 0; w < workers; w++) {
+        if (chunks[w].failed) {
+            ok = false;
+        }
+        if (ok && chunks[w].out.length > 0 &&
+            fwrite(chunks[w].out.data, 1, chunks[w].out.length, out) != chunks[w].out.length) {
+            ok = false;
+        }
+        if (stats != NULL) {
+            stats->lines += chunks[w].lines;
+            stats->errors += chunks[w].errors;
+        }
+        free(chunks[w].out.data);
+    }
+
+    if (out != NULL && out != stdout && fclose(out) != 0) {
+        ok = false;
+    } else if (out == stdout && fflush(stdout) != 0) {
+        ok = false;
+    }
+    if (text != NULL) {
+        munmap((void*)text, size);
+    }
+    if (stats != NULL) {
+        stats->seconds = nowSeconds() - start;
+    }
+    return ok;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file calcBytecode.c
+ * @brief Expression compiler, bytecode interpreter and compiled-program cache
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include "calculator.h"
+#include "calcBytecode.h"
+
+/**
+ * @brief Growable instruction buffer that also tracks the operand depth
+ */
+typedef struct {
+    BytecodeInstr* code;
+    int length;
+    int capacity;
+    int depth;
+    int maxDepth;
+} Emitter;
+
+/**
+ * @brief Append one instruction
+ * @return CALC_OK, CALC_ERR_OPERAND if a binary operator lacks operands, CALC_ERR_MEMORY
+ */
+static CalcStatus emit(Emitter* e, int op, int value) {
+    if (op != BC_PUSH && op != BC_LOAD) {
+        if (e->depth < 2) {
+            return CALC_ERR_OPERAND;
+        }
+        e->depth--;
+    } else if (++e->depth > e->maxDepth) {
+        e->maxDepth = e->depth;
+    }
+
+    if (e->length == e->capacity) {
+        int capacity = e->capacity == 0 ? 16 : e->capacity * 2;
+        BytecodeInstr* code = (BytecodeInstr*)realloc(e->code, (size_t)capacity * sizeof(BytecodeInstr));
+        if (code == NULL) {
+            return CALC_ERR_MEMORY;
+        }
+        e->code = code;
+        e->capacity = capacity;
+    }
+
+    e->code[e->length].op = op;
+    e->code[e->length].value = value;
+    e->length++;
+    return CALC_OK;
+}
+
+/**
+ * @brief Pop one operator and emit it, the compile-time counterpart of performOperation
+ */
+static CalcStatus emitOperator(Emitter* e, LinkedStack* opStack) {
+    int op;
+
+    stackTop(opStack, &op);
+    stackPop(opStack);
+
+    switch ((char)op) {
+        case '+':
+            return emit(e, BC_ADD, 0);
+        case '-':
+            return emit(e, BC_SUB, 0);
+        case '*':
+            return emit(e, BC_MUL, 0);
+        case '/':
+            return emit(e, BC_DIV, 0);
+        default:
+            return CALC_ERR_FORMAT;
+    }
+}
+
+/**
+ * @brief Check whether ch can start a variable name
+ */
+static bool isNameStart(char ch) {
+    return isalpha((unsigned char)ch) || ch == '_';
+}
+
+/**
+ * @brief Find a variable number
+ * @return Index in names, -1 if the name is unknown
+ */
+static int findVariable(const char* name, int length, const char* const* names, int nameCount) {
+    for (int v = 0; v < nameCount; v++) {
+        if (strncmp(names[v], name, (size_t)length) == 0 && names[v][length] == '\0') {
+            return v;
+        }
+    }
+    return -1;
+}
+
+CalcStatus compileExpression(const char* expr, CalcProgram* program) {
+    return compileWithVariables(expr, NULL, 0, program);
+}
+
+CalcStatus compileWithVariables(const char* expr, const char* const* names, int nameCount, CalcProgram* program) {
+    Emitter e = {NULL, 0, 0, 0, 0};
+    LinkedStack opStack;
+    CalcStatus status = CALC_OK;  // First compile error, syntax errors still win over it
+    int parenCount = 0;
+    bool lastWasOp = true;
+    int i = 0;
+    int op;
+
+    stackInit(&opStack);
+
+    // Same shunting-yard as calculateExpression, emitting instead of computing. The checks of
+    // isValidExpression are made on the way, as evaluateExpression does, so after the first
+    // compile error the scan only looks for a syntax error.
+    while (expr[i] != '\0') {
+        if (isspace((unsigned char)expr[i])) {
+            i++;
+            continue;
+        }
+
+        if (isdigit((unsigned char)expr[i])) {
+            int num = 0;
+            while (isdigit((unsigned char)expr[i])) {
+                num = num * 10 + (expr[i] - '0');
+                i++;
+            }
+            if (status == CALC_OK) {
+                status = emit(&e, BC_PUSH, num);
+            }
+            lastWasOp = false;
+            continue;
+        }
+
+        // Without variables a letter is an invalid character
+        if (nameCount > 0 && isNameStart(expr[i])) {
+            int start = i;
+            while (isalnum((unsigned char)expr[i]) || expr[i] == '_') {
+                i++;
+            }
+            if (status == CALC_OK) {
+                int v = findVariable(expr + start, i - start, names, nameCount);
+                status = v < 0 ? CALC_ERR_VARIABLE : emit(&e, BC_LOAD, v);
+            }
+            lastWasOp = false;
+            continue;
+        }
+
+        if (expr[i] == '(') {
+            parenCount++;
+            if (status == CALC_OK) {
+                stackPush(&opStack, (int)'(');
+            }
+            lastWasOp = true;
+        } else if (expr[i] == ')') {
+            if (--parenCount < 0) {
+                status = CALC_ERR_SYNTAX;  // Parentheses do not match
+                break;
+            }
+            while (status == CALC_OK && !stackIsEmpty(&opStack)) {
+                stackTop(&opStack, &op);
+                if (op == '(') {
+                    stackPop(&opStack);
+                    break;
+                }
+                status = emitOperator(&e, &opStack);
+            }
+            lastWasOp = false;
+        } else if (isOperator(expr[i])) {
+            char currentOp = expr[i];
+
+            if (lastWasOp && currentOp != '+' && currentOp != '-') {
+                status = CALC_ERR_SYNTAX;  // No consecutive non-positive/negative sign operators allowed
+                break;
+            }
+            if (status == CALC_OK) {
+                if (lastWasOp) {
+                    // Unary minus becomes 0 - x, unary plus is dropped
+                    if (currentOp == '-') {
+                        status = emit(&e, BC_PUSH, 0);
+                        stackPush(&opStack, (int)currentOp);
+                    }
+                } else {
+                    while (status == CALC_OK && !stackIsEmpty(&opStack)) {
+                        stackTop(&opStack, &op);
+                        if (op == '(' || getPriority(currentOp) > getPriority((char)op)) {
+                            break;
+                        }
+                        status = emitOperator(&e, &opStack);
+                    }
+                    stackPush(&opStack, (int)currentOp);
+                }
+            }
+            lastWasOp = true;
+        } else {
+            status = CALC_ERR_SYNTAX;  // Invalid character
+            break;
+        }
+        i++;
+    }
+
+    // Unclosed parenthesis or trailing operator
+    if (status != CALC_ERR_SYNTAX && (parenCount != 0 || lastWasOp)) {
+        status = CALC_ERR_SYNTAX;
+    }
+
+    while (!stackIsEmpty(&opStack) && status == CALC_OK) {
+        stackTop(&opStack, &op);
+        status = op == '(' ? CALC_ERR_PAREN : emitOperator(&e, &opStack);
+    }
+    stackDestroy(&opStack);
+
+    if (status == CALC_OK && e.depth != 1) {
+        status = CALC_ERR_FORMAT;
+    }
+    if (status != CALC_OK && status != CALC_ERR_SYNTAX && status != CALC_ERR_MEMORY && e.length > 0 &&
+        nameCount == 0) {
+        // calculateExpression stops at the first error, and the code emitted so far is exactly
+        // what it had evaluated when it met the structural error, so a division by zero there wins.
+        // With variables there are no values to run the prefix with, and no baseline to match
+        CalcProgram prefix = {e.code, e.length, e.maxDepth};
+        int ignored;
+        if (runProgram(&prefix, &ignored) == CALC_ERR_DIV_ZERO) {
+            status = CALC_ERR_DIV_ZERO;
+        }
+    }
+    if (status != CALC_OK) {
+        free(e.code);
+        return status;
+    }
+
+    program->code = e.code;
+    program->length = e.length;
+    program->maxDepth = e.maxDepth;
+    return CALC_OK;
+}
+
+CalcStatus runProgram(const CalcProgram* program, int* result) {
+    return runProgramWith(program, NULL, result);
+}
+
+CalcStatus runProgramWith(const CalcProgram* program, const int* variables, int* result) {
+    int inlineStack[RUN_STACK_INLINE];
+    int* stack = inlineStack;
+    int top = -1;
+    CalcStatus status = CALC_OK;
+
+    if (program->maxDepth > RUN_STACK_INLINE) {
+        stack = (int*)malloc((size_t)program->maxDepth * sizeof(int));
+        if (stack == NULL) {
+            return CALC_ERR_MEMORY;
+        }
+    }
+
+    for (int pc = 0; pc < program->length; pc++) {
+        const BytecodeInstr* in = &program->code[pc];
+        if (in->op == BC_PUSH) {
+            stack[++top] = in->value;
+            continue;
+        }
+        if (in->op == BC_LOAD) {
+            stack[++top] = variables[in->value];
+            continue;
+        }
+
+        int num2 = stack[top--];
+        int num1 = stack[top];
+        switch (in->op) {
+            case BC_ADD:
+                stack[top] = num1 + num2;
+                break;
+            case BC_SUB:
+                stack[top] = num1 - num2;
+                break;
+            case BC_MUL:
+                stack[top] = num1 * num2;
+                break;
+            default:
+                if (num2 == 0) {
+                    status = CALC_ERR_DIV_ZERO;
+                    pc = program->length;
+                    break;
+                }
+                // INT_MIN / -1 would trap, negate with wraparound instead
+                stack[top] = num2 == -1 ? (int)(0u - (unsigned)num1) : num1 / num2;
+                break;
+        }
+    }
+
+    if (status == CALC_OK) {
+        *result = stack[0];
+    }
+    if (stack != inlineStack) {
+        free(stack);
+    }
+    return status;
+}
+
+void freeProgram(CalcProgram* program) {
+    free(program->code);
+    program->code = NULL;
+    program->length = 0;
+    program->maxDepth = 0;
+}
+
+/**
+ * @brief FNV-1a hash of the expression text
+ */
+static unsigned hashText(const char* text) {
+    unsigned hash = 2166136261u;
+
+    while (*text != '\0') {
+        hash ^= (unsigned char)*text++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Drop every entry of the cache
+ */
+static void programCacheFlush(ProgramCache* cache) {
+    for (int i = 0; i < cache->capacity; i++) {
+        ProgramCacheEntry* entry = &cache->entries[i];
+        if (entry->text != NULL) {
+            free(entry->text);
+            entry->text = NULL;
+            if (entry->status == CALC_OK) {
+                freeProgram(&entry->program);
+            }
+        }
+    }
+    cache->count = 0;
+}
+
+bool programCacheInit(ProgramCache* cache, int capacity) {
+    int size = 16;
+
+    while (size < capacity) {
+        size *= 2;
+    }
+
+    cache->entries = (ProgramCacheEntry*)calloc((size_t)size, sizeof(ProgramCacheEntry));
+    if (cache->entries == NULL) {
+        return false;
+    }
+    cache->capacity = size;
+    cache->count = 0;
+    cache->hits = 0;
+    cache->misses = 0;
+    return true;
+}
+
+void programCacheDestroy(ProgramCache* cache) {
+    programCacheFlush(cache);
+    free(cache->entries);
+    cache->entries = NULL;
+    cache->capacity = 0;
+}
+
+CalcStatus evaluateCached(ProgramCache* cache, const char* expr, int* result) {
+    unsigned hash = hashText(expr);
+    int mask = cache->capacity - 1;
+    int i = (int)(hash & (unsigned)mask);
+    ProgramCacheEntry* entry;
+
+    // Linear probing until the text or an empty slot is found
+    while (cache->entries[i].text != NULL) {
+        entry = &cache->entries[i];
+        if (entry->hash == hash && strcmp(entry->text, expr) == 0) {
+            cache->hits++;
+            return entry->status == CALC_OK ? runProgram(&entry->program, result) : entry->status;
+        }
+        i = (i + 1) & mask;
+    }
+
+    cache->misses++;
+    if (2 * (cache->count + 1) > cache->capacity) {
+        programCacheFlush(cache);
+        i = (int)(hash & (unsigned)mask);
+    }
+
+    entry = &cache->entries[i];
+    entry->text = (char*)malloc(strlen(expr) + 1);
+    if (entry->text == NULL) {
+        return CALC_ERR_MEMORY;
+    }
+    strcpy(entry->text, expr);
+    entry->hash = hash;
+    entry->status = compileExpression(expr, &entry->program);
+    if (entry->status == CALC_ERR_MEMORY) {
+        free(entry->text);
+        entry->text = NULL;
+        return CALC_ERR_MEMORY;
+    }
+    cache->count++;
+
+    return entry->status == CALC_OK ? runProgram(&entry->program, result) : entry->status;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file calcColumns.c
+ * @brief Block-at-a-time DAG evaluation with SIMD arithmetic kernels
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "calculator.h"
+#include "calcBytecode.h"
+#include "calcAst.h"
+#include "calcColumns.h"
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * @brief r = a + b, wrapping
+ */
+static void addKernel(int32_t* r, const int32_t* a, const int32_t* b, size_t n) {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(r + i), _mm256_add_epi32(x, y));
+    }
+#elif defined(__SSE2__)
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(r + i), _mm_add_epi32(x, y));
+    }
+#endif
+    for (; i < n; i++) {
+        r[i] = (int32_t)((uint32_t)a[i] + (uint32_t)b[i]);
+    }
+}
+
+/**
+ * @brief r = a - b, wrapping
+ */
+static void subKernel(int32_t* r, const int32_t* a, const int32_t* b, size_t n) {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(r + i), _mm256_sub_epi32(x, y));
+    }
+#elif defined(__SSE2__)
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(r + i), _mm_sub_epi32(x, y));
+    }
+#endif
+    for (; i < n; i++) {
+        r[i] = (int32_t)((uint32_t)a[i] - (uint32_t)b[i]);
+    }
+}
+
+/**
+ * @brief r = a * b, low 32 bits
+ * @note SSE2 has no 32-bit lane multiply, the even and odd lanes go through pmuludq
+ */
+static void mulKernel(int32_t* r, const int32_t* a, const int32_t* b, size_t n) {
+    size_t i = 0;
+
+#if defined(__AVX2__)
+    for (; i + 8 <= n; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(a + i));
+        __m256i y = _mm256_loadu_si256((const __m256i*)(b + i));
+        _mm256_storeu_si256((__m256i*)(r + i), _mm256_mullo_epi32(x, y));
+    }
+#elif defined(__SSE4_1__)
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        _mm_storeu_si128((__m128i*)(r + i), _mm_mullo_epi32(x, y));
+    }
+#elif defined(__SSE2__)
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(a + i));
+        __m128i y = _mm_loadu_si128((const __m128i*)(b + i));
+        __m128i even = _mm_mul_epu32(x, y);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(x, 32), _mm_srli_epi64(y, 32));
+        __m128i lo = _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                        _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+        _mm_storeu_si128((__m128i*)(r + i), lo);
+    }
+#endif
+    for (; i < n; i++) {
+        r[i] = (int32_t)((uint32_t)a[i] * (uint32_t)b[i]);
+    }
+}
+
+/**
+ * @brief r = a / b truncated, rows dividing by zero get 0 and are flagged in mask
+ * @note x86 has no integer vector division, so this stays a scalar loop
+ */
+static void divKernel(int32_t* r, const int32_t* a, const int32_t* b, size_t n, uint8_t* mask) {
+    for (size_t i = 0; i < n; i++) {
+        int32_t d = b[i];
+        if (d == 0) {
+            mask[i] = 1;
+            r[i] = 0;
+        } else if (d == -1) {
+            r[i] = (int32_t)(0u - (uint32_t)a[i]);  // INT32_MIN / -1 would trap
+        } else {
+            r[i] = a[i] / d;
+        }
+    }
+}
+
+CalcStatus evaluateColumns(const CalcAst* ast, const int32_t* const* columns, size_t rows,
+                           int32_t* out, uint8_t* errorMask, size_t* errorRows) {
+    int count = ast->count;
+    int32_t* scratch = (int32_t*)malloc((size_t)count * CALC_COLUMN_BLOCK * sizeof(int32_t));
+    const int32_t** src = (const int32_t**)malloc((size_t)count * sizeof(int32_t*));
+    size_t errors = 0;
+
+    if (scratch == NULL || src == NULL) {
+        free(scratch);
+        free(src);
+        return CALC_ERR_MEMORY;
+    }
+
+    // Constant vectors are filled once and shared by every block
+    for (int k = 0; k < count; k++) {
+        if (ast->nodes[k].op == BC_PUSH) {
+            int32_t* v = scratch + (size_t)k * CALC_COLUMN_BLOCK;
+            for (int i = 0; i < CALC_COLUMN_BLOCK; i++) {
+                v[i] = ast->nodes[k].value;
+            }
+            src[k] = v;
+        }
+    }
+
+    for (size_t base = 0; base < rows; base += CALC_COLUMN_BLOCK) {
+        size_t n = rows - base < CALC_COLUMN_BLOCK ? rows - base : CALC_COLUMN_BLOCK;
+        uint8_t* mask = errorMask + base;
+
+        memset(mask, 0, n);
+        for (int k = 0; k < count; k++) {
+            const AstNode* node = &ast->nodes[k];
+            int32_t* v = scratch + (size_t)k * CALC_COLUMN_BLOCK;
+            switch (node->op) {
+                case BC_PUSH:
+                    break;
+                case BC_LOAD:
+                    src[k] = columns[node->value] + base;  // Read in place
+                    break;
+                case BC_ADD:
+                    addKernel(v, src[node->left], src[node->right], n);
+                    src[k] = v;
+                    break;
+                case BC_SUB:
+                    subKernel(v, src[node->left], src[node->right], n);
+                    src[k] = v;
+                    break;
+                case BC_MUL:
+                    mulKernel(v, src[node->left], src[node->right], n);
+                    src[k] = v;
+                    break;
+                default:
+                    divKernel(v, src[node->left], src[node->right], n, mask);
+                    src[k] = v;
+                    break;
+            }
+        }
+
+        const int32_t* result = src[count - 1];
+        for (size_t i = 0; i < n; i++) {
+            out[base + i] = mask[i] ? 0 : result[i];
+            errors += mask[i];
+        }
+    }
+
+    free(scratch);
+    free(src);
+    if (errorRows != NULL) {
+        *errorRows = errors;
+    }
+    return CALC_OK;
+}
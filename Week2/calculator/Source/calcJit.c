@@ -0,0 +1,282 @@
+/**
+ * @file calcJit.c
+ * @brief x86-64 code generation for compiled expressions, with an interpreter fallback
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "calculator.h"
+#include "calcBytecode.h"
+#include "calcJit.h"
+
+#if CALC_JIT_NATIVE
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define MAX_INSTR_BYTES 32  /**< Longest encoding of one bytecode instruction */
+#define FRAME_BYTES 32      /**< Prologue and both epilogues */
+
+/**
+ * @brief Generated function: variables in rdi, result in rsi, returns 0 or 1 on division by zero
+ */
+typedef int (*CalcJitFn)(const int* variables, int* result);
+
+/**
+ * @brief Code being assembled, with the jumps that still need the error label
+ */
+typedef struct {
+    uint8_t* bytes;
+    size_t length;
+    size_t* fixups;       /**< Offsets of rel32 fields that jump to the error exit */
+    int fixupCount;
+} Assembler;
+
+static void put(Assembler* as, const uint8_t* bytes, size_t n) {
+    memcpy(as->bytes + as->length, bytes, n);
+    as->length += n;
+}
+
+static void put32(Assembler* as, int32_t value) {
+    memcpy(as->bytes + as->length, &value, 4);
+    as->length += 4;
+}
+
+/**
+ * @brief Jump to the error exit, conditional on ZF when jz is true
+ */
+static void jumpToError(Assembler* as, bool jz) {
+    static const uint8_t jzOp[] = {0x0F, 0x84};
+    static const uint8_t jmpOp[] = {0xE9};
+
+    if (jz) {
+        put(as, jzOp, sizeof(jzOp));
+    } else {
+        put(as, jmpOp, sizeof(jmpOp));
+    }
+    as->fixups[as->fixupCount++] = as->length;
+    put32(as, 0);
+}
+
+/**
+ * @brief Load a leaf into eax, spilling the old top of stack first
+ */
+static void emitLeaf(Assembler* as, const BytecodeInstr* in, int depth) {
+    static const uint8_t pushRax[] = {0x50};
+    static const uint8_t movEaxImm[] = {0xB8};               // mov eax, imm32
+    static const uint8_t movEaxMem[] = {0x8B, 0x87};         // mov eax, [rdi + disp32]
+
+    if (depth > 0) {
+        put(as, pushRax, sizeof(pushRax));
+    }
+    if (in->op == BC_PUSH) {
+        put(as, movEaxImm, sizeof(movEaxImm));
+        put32(as, in->value);
+    } else {
+        put(as, movEaxMem, sizeof(movEaxMem));
+        put32(as, in->value * 4);
+    }
+}
+
+/**
+ * @brief eax = eax / r8d for a divisor only known at run time, -1 negates instead of dividing
+ */
+static const uint8_t divR8Checked[] = {0x41, 0x83, 0xF8, 0xFF,  // cmp r8d, -1
+                                       0x75, 0x04,              // jne idiv
+                                       0xF7, 0xD8,              // neg eax, INT_MIN / -1 would trap
+                                       0xEB, 0x04,              // jmp past idiv
+                                       0x99, 0x41, 0xF7, 0xF8}; // idiv: cdq; idiv r8d
+
+/**
+ * @brief eax = eax op leaf, the leaf used directly as an immediate or memory operand
+ */
+static void emitFused(Assembler* as, int op, const BytecodeInstr* leaf) {
+    static const uint8_t addImm[] = {0x05};                  // add eax, imm32
+    static const uint8_t addMem[] = {0x03, 0x87};            // add eax, [rdi + disp32]
+    static const uint8_t subImm[] = {0x2D};                  // sub eax, imm32
+    static const uint8_t subMem[] = {0x2B, 0x87};            // sub eax, [rdi + disp32]
+    static const uint8_t mulImm[] = {0x69, 0xC0};            // imul eax, eax, imm32
+    static const uint8_t mulMem[] = {0x0F, 0xAF, 0x87};      // imul eax, [rdi + disp32]
+    static const uint8_t movR8Imm[] = {0x41, 0xB8};          // mov r8d, imm32
+    static const uint8_t movR8Mem[] = {0x44, 0x8B, 0x87};    // mov r8d, [rdi + disp32]
+    static const uint8_t testR8[] = {0x45, 0x85, 0xC0};      // test r8d, r8d
+    static const uint8_t divR8[] = {0x99, 0x41, 0xF7, 0xF8}; // cdq; idiv r8d
+    static const uint8_t negEax[] = {0xF7, 0xD8};            // neg eax
+    bool imm = leaf->op == BC_PUSH;
+    int32_t operand = imm ? leaf->value : leaf->value * 4;
+
+    switch (op) {
+        case BC_ADD:
+            imm ? put(as, addImm, sizeof(addImm)) : put(as, addMem, sizeof(addMem));
+            put32(as, operand);
+            break;
+        case BC_SUB:
+            imm ? put(as, subImm, sizeof(subImm)) : put(as, subMem, sizeof(subMem));
+            put32(as, operand);
+            break;
+        case BC_MUL:
+            imm ? put(as, mulImm, sizeof(mulImm)) : put(as, mulMem, sizeof(mulMem));
+            put32(as, operand);
+            break;
+        default:
+            if (imm && operand == 0) {
+                jumpToError(as, false);  // Constant zero divisor always fails
+                break;
+            }
+            if (imm && operand == -1) {
+                put(as, negEax, sizeof(negEax));  // idiv would trap on INT_MIN / -1
+                break;
+            }
+            imm ? put(as, movR8Imm, sizeof(movR8Imm)) : put(as, movR8Mem, sizeof(movR8Mem));
+            put32(as, operand);
+            if (!imm) {
+                put(as, testR8, sizeof(testR8));
+                jumpToError(as, true);
+                put(as, divR8Checked, sizeof(divR8Checked));
+            } else {
+                put(as, divR8, sizeof(divR8));
+            }
+            break;
+    }
+}
+
+/**
+ * @brief eax = second op eax, the second operand popped from the machine stack
+ */
+static void emitBinary(Assembler* as, int op) {
+    static const uint8_t popRcx[] = {0x59};
+    static const uint8_t add[] = {0x01, 0xC8};                    // add eax, ecx
+    static const uint8_t sub[] = {0x29, 0xC1, 0x89, 0xC8};        // sub ecx, eax; mov eax, ecx
+    static const uint8_t mul[] = {0x0F, 0xAF, 0xC1};              // imul eax, ecx
+    static const uint8_t testEax[] = {0x85, 0xC0};                // test eax, eax
+    static const uint8_t div[] = {0x41, 0x89, 0xC0, 0x89, 0xC8};  // mov r8d, eax; mov eax, ecx
+
+    put(as, popRcx, sizeof(popRcx));
+    switch (op) {
+        case BC_ADD:
+            put(as, add, sizeof(add));
+            break;
+        case BC_SUB:
+            put(as, sub, sizeof(sub));
+            break;
+        case BC_MUL:
+            put(as, mul, sizeof(mul));
+            break;
+        default:
+            put(as, testEax, sizeof(testEax));
+            jumpToError(as, true);
+            put(as, div, sizeof(div));
+            put(as, divR8Checked, sizeof(divR8Checked));
+            break;
+    }
+}
+
+/**
+ * @brief Translate a program and map it executable
+ * @return true if native code was produced
+ */
+static bool generate(CalcJit* jit) {
+    static const uint8_t prologue[] = {0x49, 0x89, 0xE1};                   // mov r9, rsp
+    static const uint8_t success[] = {0x89, 0x06, 0x31, 0xC0, 0xC3};        // mov [rsi], eax; xor eax, eax; ret
+    static const uint8_t failure[] = {0x4C, 0x89, 0xCC,                     // mov rsp, r9
+                                      0xB8, 0x01, 0x00, 0x00, 0x00, 0xC3};  // mov eax, 1; ret
+    const CalcProgram* program = &jit->program;
+    size_t bound = (size_t)program->length * MAX_INSTR_BYTES + FRAME_BYTES;
+    Assembler as = {NULL, 0, NULL, 0};
+    int depth = 0;
+    bool ok = false;
+
+    as.bytes = (uint8_t*)malloc(bound);
+    as.fixups = (size_t*)malloc((size_t)program->length * sizeof(size_t) + sizeof(size_t));
+    if (as.bytes == NULL || as.fixups == NULL) {
+        goto done;
+    }
+
+    put(&as, prologue, sizeof(prologue));
+    for (int pc = 0; pc < program->length; pc++) {
+        const BytecodeInstr* in = &program->code[pc];
+        if (in->op == BC_PUSH || in->op == BC_LOAD) {
+            // A leaf consumed right away by the next operator needs no stack traffic
+            if (pc + 1 < program->length && depth > 0 &&
+                program->code[pc + 1].op != BC_PUSH && program->code[pc + 1].op != BC_LOAD) {
+                emitFused(&as, program->code[pc + 1].op, in);
+                pc++;
+                continue;
+            }
+            emitLeaf(&as, in, depth);
+            depth++;
+        } else {
+            emitBinary(&as, in->op);
+            depth--;
+        }
+    }
+    put(&as, success, sizeof(success));
+
+    size_t errorLabel = as.length;
+    put(&as, failure, sizeof(failure));
+    for (int f = 0; f < as.fixupCount; f++) {
+        int32_t rel = (int32_t)(errorLabel - (as.fixups[f] + 4));
+        memcpy(as.bytes + as.fixups[f], &rel, 4);
+    }
+
+    // Written while writable, then flipped to executable, never both at once
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t size = (as.length + page - 1) / page * page;
+    void* code = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED) {
+        goto done;
+    }
+    memcpy(code, as.bytes, as.length);
+    if (mprotect(code, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(code, size);
+        goto done;
+    }
+    jit->code = code;
+    jit->size = size;
+    ok = true;
+
+done:
+    free(as.bytes);
+    free(as.fixups);
+    return ok;
+}
+#endif /* CALC_JIT_NATIVE */
+
+CalcStatus calcJitCompile(const char* expr, const char* const* names, int nameCount, CalcJit* jit) {
+    CalcStatus status = compileWithVariables(expr, names, nameCount, &jit->program);
+
+    jit->code = NULL;
+    jit->size = 0;
+    if (status != CALC_OK) {
+        return status;
+    }
+
+#if CALC_JIT_NATIVE
+    generate(jit);  // Failure leaves code NULL, the interpreter takes over
+#endif
+    return CALC_OK;
+}
+
+bool calcJitIsNative(const CalcJit* jit) {
+    return jit->code != NULL;
+}
+
+CalcStatus calcJitRun(const CalcJit* jit, const int* variables, int* result) {
+#if CALC_JIT_NATIVE
+    if (jit->code != NULL) {
+        return ((CalcJitFn)jit->code)(variables, result) == 0 ? CALC_OK : CALC_ERR_DIV_ZERO;
+    }
+#endif
+    return runProgramWith(&jit->program, variables, result);
+}
+
+void calcJitFree(CalcJit* jit) {
+#if CALC_JIT_NATIVE
+    if (jit->code != NULL) {
+        munmap(jit->code, jit->size);
+    }
+#endif
+    jit->code = NULL;
+    jit->size = 0;
+    freeProgram(&jit->program);
+}
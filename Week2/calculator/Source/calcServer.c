@@ -0,0 +1,432 @@
+/**
+ * @file calcServer.c
+ * @brief Single-threaded epoll server answering pipelined expressions
+ */
+
+#define _GNU_SOURCE  /* accept4 */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include "calculator.h"
+#include "calcStream.h"
+#include "calcServer.h"
+
+#define MAX_EVENTS 64         /**< Events taken from epoll per wait */
+#define READ_CHUNK 65536      /**< Free space ensured before each read */
+
+/**
+ * @brief Growable byte buffer
+ */
+typedef struct {
+    char* data;
+    size_t length;
+    size_t capacity;
+} ByteBuffer;
+
+/**
+ * @brief State of one client, linked into the list of open connections
+ */
+typedef struct Connection {
+    int fd;
+    ByteBuffer in;        /**< Received bytes not yet evaluated, at most one partial line */
+    ByteBuffer out;       /**< Answers not yet fully sent */
+    size_t sent;          /**< Bytes of out already sent */
+    uint32_t events;      /**< Interest currently registered with epoll */
+    bool peerClosed;      /**< The client shut down its side, close once out is sent */
+    struct Connection* prev;
+    struct Connection* next;
+} Connection;
+
+/**
+ * @brief Make room for extra more bytes
+ */
+static bool reserve(ByteBuffer* buffer, size_t extra) {
+    if (buffer->length + extra <= buffer->capacity) {
+        return true;
+    }
+
+    size_t capacity = buffer->capacity == 0 ? 4096 : buffer->capacity;
+    while (capacity < buffer->length + extra) {
+        capacity *= 2;
+    }
+    char* data = (char*)realloc(buffer->data, capacity);
+    if (data == NULL) {
+        return false;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Fill a socket address from "unix:<path>" or "tcp:<port>"
+ */
+static bool parseAddress(const char* address, struct sockaddr_storage* addr, socklen_t* length) {
+    memset(addr, 0, sizeof(*addr));
+    if (strncmp(address, "unix:", 5) == 0) {
+        struct sockaddr_un* un = (struct sockaddr_un*)addr;
+        const char* path = address + 5;
+        if (*path == '\0' || strlen(path) >= sizeof(un->sun_path)) {
+            return false;
+        }
+        un->sun_family = AF_UNIX;
+        strcpy(un->sun_path, path);
+        *length = sizeof(*un);
+        return true;
+    }
+    if (strncmp(address, "tcp:", 4) == 0) {
+        struct sockaddr_in* in = (struct sockaddr_in*)addr;
+        char* end;
+        long port = strtol(address + 4, &end, 10);
+        if (end == address + 4 || *end != '\0' || port < 0 || port > 65535) {
+            return false;
+        }
+        in->sin_family = AF_INET;
+        in->sin_port = htons((uint16_t)port);
+        in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        *length = sizeof(*in);
+        return true;
+    }
+    return false;
+}
+
+int calcServerListen(const char* address) {
+    struct sockaddr_storage addr;
+    socklen_t length;
+    int one = 1;
+    int fd;
+
+    if (!parseAddress(address, &addr, &length)) {
+        errno = EINVAL;
+        return -1;
+    }
+    fd = socket(addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (addr.ss_family == AF_UNIX) {
+        unlink(((struct sockaddr_un*)&addr)->sun_path);
+    } else {
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    }
+    if (bind(fd, (struct sockaddr*)&addr, length) != 0 || listen(fd, SOMAXCONN) != 0) {
+        int saved = errno;
+        close(fd);
+        errno = saved;
+        return -1;
+    }
+    return fd;
+}
+
+void calcServerClose(int listenFd, const char* address) {
+    struct sockaddr_storage addr;
+    socklen_t length;
+
+    close(listenFd);
+    if (parseAddress(address, &addr, &length) && addr.ss_family == AF_UNIX) {
+        unlink(((struct sockaddr_un*)&addr)->sun_path);
+    }
+}
+
+int calcServerConnect(const char* address) {
+    struct sockaddr_storage addr;
+    socklen_t length;
+    int one = 1;
+    int fd;
+
+    if (!parseAddress(address, &addr, &length)) {
+        errno = EINVAL;
+        return -1;
+    }
+    fd = socket(addr.ss_family, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr*)&addr, length) != 0) {
+        int saved = errno;
+        close(fd);
+        errno = saved;
+        return -1;
+    }
+    if (addr.ss_family == AF_INET) {
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    }
+    return fd;
+}
+
+/**
+ * @brief Append the answer of one expression, in the batch format
+ */
+static bool appendAnswer(Connection* conn, ServerStats* stats, CalcStatus status, int result,
+                         long long errorPos) {
+    int written;
+
+    // A status message is well under 128 bytes
+    if (!reserve(&conn->out, 128)) {
+        return false;
+    }
+    if (status == CALC_OK) {
+        written = snprintf(conn->out.data + conn->out.length, 128, "%d\n", result);
+    } else {
+        stats->errors++;
+        written = snprintf(conn->out.data + conn->out.length, 128, "error %lld %s\n",
+                           errorPos + 1, calcStatusMessage(status));
+    }
+    conn->out.length += (size_t)written;
+    stats->requests++;
+    return true;
+}
+
+/**
+ * @brief Answer every complete line in the input buffer, and the partial one after end of input
+ * @return false if memory ran out
+ */
+static bool evaluateLines(Connection* conn, ServerStats* stats) {
+    size_t complete = conn->in.length;
+    CalcReader reader;
+
+    if (!conn->peerClosed) {
+        while (complete > 0 && conn->in.data[complete - 1] != '\n') {
+            complete--;
+        }
+    }
+    if (complete == 0) {
+        return true;
+    }
+
+    calcReaderInitBuffer(&reader, conn->in.data, complete);
+    while (!calcReaderAtEnd(&reader)) {
+        int result = 0;
+        long long errorPos = 0;
+        CalcStatus status = evaluateStream(&reader, &result, &errorPos);
+        if (!appendAnswer(conn, stats, status, result, errorPos)) {
+            return false;
+        }
+    }
+
+    // Keep only the partial line
+    memmove(conn->in.data, conn->in.data + complete, conn->in.length - complete);
+    conn->in.length -= complete;
+    return true;
+}
+
+/**
+ * @brief Send as much of the pending output as the socket takes
+ * @return false if the connection failed
+ */
+static bool flushOutput(Connection* conn) {
+    while (conn->sent < conn->out.length) {
+        ssize_t n = send(conn->fd, conn->out.data + conn->sent, conn->out.length - conn->sent,
+                         MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        conn->sent += (size_t)n;
+    }
+    conn->out.length = 0;  // Everything sent, reuse the buffer from the start
+    conn->sent = 0;
+    return true;
+}
+
+/**
+ * @brief Read what has arrived and answer it
+ * @return false if the connection failed or sent an overlong line
+ */
+static bool readInput(Connection* conn, ServerStats* stats) {
+    // Stop at the pending limit, level-triggered epoll reports the rest later
+    while (!conn->peerClosed && conn->out.length - conn->sent < CALC_SERVER_MAX_PENDING) {
+        if (!reserve(&conn->in, READ_CHUNK)) {
+            return false;
+        }
+        ssize_t n = recv(conn->fd, conn->in.data + conn->in.length,
+                         conn->in.capacity - conn->in.length, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno == EAGAIN || errno == EWOULDBLOCK;
+        }
+        if (n == 0) {
+            conn->peerClosed = true;
+        }
+        conn->in.length += (size_t)n;
+        if (!evaluateLines(conn, stats) || conn->in.length > CALC_SERVER_MAX_LINE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Register the interest matching the connection state
+ */
+static bool updateInterest(int epollFd, Connection* conn) {
+    bool pending = conn->sent < conn->out.length;
+    uint32_t events = 0;
+    struct epoll_event ev;
+
+    if (!conn->peerClosed && conn->out.length - conn->sent < CALC_SERVER_MAX_PENDING) {
+        events |= EPOLLIN;
+    }
+    if (pending) {
+        events |= EPOLLOUT;
+    }
+    if (events == conn->events) {
+        return true;
+    }
+    ev.events = events;
+    ev.data.ptr = conn;
+    conn->events = events;
+    return epoll_ctl(epollFd, EPOLL_CTL_MOD, conn->fd, &ev) == 0;
+}
+
+static void closeConnection(Connection** list, Connection* conn) {
+    if (conn->prev != NULL) {
+        conn->prev->next = conn->next;
+    } else {
+        *list = conn->next;
+    }
+    if (conn->next != NULL) {
+        conn->next->prev = conn->prev;
+    }
+    close(conn->fd);  // Also removes it from the epoll set
+    free(conn->in.data);
+    free(conn->out.data);
+    free(conn);
+}
+
+/**
+ * @brief Accept every pending connection
+ */
+static void acceptClients(int epollFd, int listenFd, Connection** list, ServerStats* stats) {
+    for (;;) {
+        int fd = accept4(listenFd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            return;  // EAGAIN, or out of descriptors until a client leaves
+        }
+
+        Connection* conn = (Connection*)calloc(1, sizeof(Connection));
+        struct epoll_event ev;
+        int one = 1;
+        if (conn == NULL) {
+            close(fd);
+            continue;
+        }
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));  // Fails harmlessly on UNIX sockets
+        conn->fd = fd;
+        conn->events = EPOLLIN;
+        ev.events = EPOLLIN;
+        ev.data.ptr = conn;
+        if (epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &ev) != 0) {
+            close(fd);
+            free(conn);
+            continue;
+        }
+        conn->next = *list;
+        if (*list != NULL) {
+            (*list)->prev = conn;
+        }
+        *list = conn;
+        stats->connections++;
+    }
+}
+
+bool calcServerRun(int listenFd, volatile sig_atomic_t* stop, ServerStats* stats) {
+    struct epoll_event events[MAX_EVENTS];
+    struct epoll_event ev;
+    ServerStats totals = {0, 0, 0};
+    Connection* list = NULL;
+    sigset_t stopSignals, blocked, waitMask;
+    bool ok = true;
+    int epollFd;
+
+    epollFd = epoll_create1(EPOLL_CLOEXEC);
+    if (epollFd < 0) {
+        return false;
+    }
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;  // NULL marks the listening socket
+    if (epoll_ctl(epollFd, EPOLL_CTL_ADD, listenFd, &ev) != 0) {
+        close(epollFd);
+        return false;
+    }
+
+    // The stop signals stay blocked outside epoll_pwait, which unblocks them atomically. A signal
+    // landing between the check of stop and the wait is then held pending and wakes the wait,
+    // instead of being handled just before epoll_wait blocks with nothing left to wake it.
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &stopSignals, &blocked);
+    waitMask = blocked;
+    sigdelset(&waitMask, SIGINT);
+    sigdelset(&waitMask, SIGTERM);
+
+    while (!*stop) {
+        int ready = epoll_pwait(epollFd, events, MAX_EVENTS, -1, &waitMask);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ok = false;
+            break;
+        }
+
+        for (int e = 0; e < ready; e++) {
+            Connection* conn = (Connection*)events[e].data.ptr;
+            bool alive = true;
+
+            if (conn == NULL) {
+                acceptClients(epollFd, listenFd, &list, &totals);
+                continue;
+            }
+            if (events[e].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                alive = readInput(conn, &totals);
+            }
+            if (alive) {
+                alive = flushOutput(conn);
+            }
+            // A client that has hung up is closed once all its answers are out
+            if (alive && conn->peerClosed && conn->sent == conn->out.length) {
+                alive = false;
+            }
+            if (!alive || !updateInterest(epollFd, conn)) {
+                closeConnection(&list, conn);
+            }
+        }
+    }
+
+    pthread_sigmask(SIG_SETMASK, &blocked, NULL);
+
+    while (list != NULL) {
+        closeConnection(&list, list);
+    }
+    close(epollFd);
+
+    // Return the nodes this thread cached while evaluating
+    LinkedStack empty;
+    stackInit(&empty);
+    stackShrink(&empty);
+
+    if (stats != NULL) {
+        *stats = totals;
+    }
+    return ok;
+}
@@ -0,0 +1,415 @@
+/**
+ * @file calcStream.c
+ * @brief Streaming tokenizer and single-pass evaluator over a bounded input window
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <unistd.h>
+#include "calculator.h"
+#include "calcStream.h"
+
+/**
+ * @brief Reset the fields shared by every source
+ */
+static void readerReset(CalcReader* reader) {
+    reader->data = NULL;
+    reader->length = 0;
+    reader->pos = 0;
+    reader->consumed = 0;
+    reader->lineStart = 0;
+    reader->fd = -1;
+    reader->file = NULL;
+    reader->window = NULL;
+    reader->stopAtNewline = true;
+    reader->failed = false;
+}
+
+void calcReaderInitBuffer(CalcReader* reader, const char* data, size_t length) {
+    readerReset(reader);
+    reader->data = data;
+    reader->length = length;
+}
+
+bool calcReaderInitFd(CalcReader* reader, int fd) {
+    readerReset(reader);
+    reader->window = (char*)malloc(CALC_STREAM_WINDOW);
+    if (reader->window == NULL) {
+        return false;
+    }
+    reader->data = reader->window;
+    reader->fd = fd;
+    return true;
+}
+
+bool calcReaderInitFile(CalcReader* reader, FILE* file, const char* prefix, size_t prefixLength) {
+    readerReset(reader);
+    reader->window = (char*)malloc(CALC_STREAM_WINDOW);
+    if (reader->window == NULL) {
+        return false;
+    }
+    if (prefixLength > CALC_STREAM_WINDOW) {
+        prefixLength = CALC_STREAM_WINDOW;
+    }
+    if (prefixLength > 0) {
+        memcpy(reader->window, prefix, prefixLength);
+    }
+    reader->data = reader->window;
+    reader->length = prefixLength;
+    reader->file = file;
+    return true;
+}
+
+void calcReaderDestroy(CalcReader* reader) {
+    free(reader->window);
+    readerReset(reader);
+}
+
+/**
+ * @brief Slide the window forward once it is used up
+ * @return true if new bytes are available
+ */
+static bool refill(CalcReader* reader) {
+    ssize_t n = 0;
+
+    if (reader->window == NULL) {
+        return false;  // Memory buffer, nothing more to read
+    }
+
+    reader->consumed += (long long)reader->length;
+    reader->pos = 0;
+    reader->length = 0;
+
+    if (reader->fd >= 0) {
+        n = read(reader->fd, reader->window, CALC_STREAM_WINDOW);
+    } else if (reader->file != NULL) {
+        // fgets stops at the newline, so an interactive stream is never read ahead
+        if (fgets(reader->window, CALC_STREAM_WINDOW, reader->file) != NULL) {
+            n = (ssize_t)strlen(reader->window);
+        } else if (ferror(reader->file)) {
+            n = -1;
+        }
+    }
+    if (n < 0) {
+        reader->failed = true;
+        return false;
+    }
+    reader->length = (size_t)n;
+    return n > 0;
+}
+
+/**
+ * @brief Look at the next byte without consuming it
+ * @return The byte, or EOF at the end of the input
+ */
+static inline int peekByte(CalcReader* reader) {
+    if (reader->pos == reader->length && !refill(reader)) {
+        return EOF;
+    }
+    return (unsigned char)reader->data[reader->pos];
+}
+
+/**
+ * @brief Offset of the next byte from the start of the current expression
+ */
+static inline long long positionOf(const CalcReader* reader) {
+    return reader->consumed + (long long)reader->pos - reader->lineStart;
+}
+
+bool calcReaderAtEnd(CalcReader* reader) {
+    return peekByte(reader) == EOF;
+}
+
+/**
+ * @brief isspace of the C locale, without the locale table lookup
+ */
+static inline bool isBlank(int ch) {
+    return ch == ' ' || (ch >= '\t' && ch <= '\r');
+}
+
+/**
+ * @brief Tokenizer body, inlined into evaluateStream
+ * @note Spaces and digits are scanned directly in the window, the window is only
+ *       refilled when a run of them reaches its end.
+ */
+static inline void scanToken(CalcReader* reader, CalcToken* token) {
+    const char* p;
+    const char* end;
+    int ch;
+
+    // Skip spaces, a newline ends the expression in line mode
+    for (;;) {
+        p = reader->data + reader->pos;
+        end = reader->data + reader->length;
+        while (p < end && isBlank((unsigned char)*p) && (*p != '\n' || !reader->stopAtNewline)) {
+            p++;
+        }
+        reader->pos = (size_t)(p - reader->data);
+        if (p < end || !refill(reader)) {
+            break;
+        }
+    }
+
+    token->position = positionOf(reader);
+    ch = reader->pos < reader->length ? (unsigned char)reader->data[reader->pos] : EOF;
+    if (ch == EOF || ch == '\n') {
+        token->type = CALC_TOKEN_END;
+        token->value = 0;
+        return;
+    }
+
+    if (ch >= '0' && ch <= '9') {
+        // Wraps like the int accumulation in calculateExpression, without the undefined behaviour
+        unsigned num = 0;
+        for (;;) {
+            p = reader->data + reader->pos;
+            end = reader->data + reader->length;
+            while (p < end && *p >= '0' && *p <= '9') {
+                num = num * 10u + (unsigned)(*p - '0');
+                p++;
+            }
+            reader->pos = (size_t)(p - reader->data);
+            if (p < end || !refill(reader)) {
+                break;
+            }
+        }
+        token->type = CALC_TOKEN_NUMBER;
+        token->value = (int)num;
+        return;
+    }
+
+    reader->pos++;
+    token->value = ch;
+    switch (ch) {
+        case '(':
+            token->type = CALC_TOKEN_LPAREN;
+            break;
+        case ')':
+            token->type = CALC_TOKEN_RPAREN;
+            break;
+        case '+':
+        case '-':
+        case '*':
+        case '/':
+            token->type = CALC_TOKEN_OPERATOR;
+            break;
+        default:
+            token->type = CALC_TOKEN_INVALID;
+            break;
+    }
+}
+
+void calcNextToken(CalcReader* reader, CalcToken* token) {
+    scanToken(reader, token);
+}
+
+void calcReaderNextLine(CalcReader* reader) {
+    int ch = peekByte(reader);
+
+    while (ch != EOF && (ch != '\n' || !reader->stopAtNewline)) {
+        // Jump straight to the newline inside the window
+        const char* newline = reader->stopAtNewline
+            ? (const char*)memchr(reader->data + reader->pos, '\n', reader->length - reader->pos)
+            : NULL;
+        reader->pos = newline != NULL ? (size_t)(newline - reader->data) : reader->length;
+        ch = peekByte(reader);
+    }
+    if (ch == '\n') {
+        reader->pos++;
+    }
+    reader->lineStart = reader->consumed + (long long)reader->pos;
+}
+
+/**
+ * @brief Operator positions are kept on an int stack, longer expressions saturate
+ */
+static inline int stackPosition(long long position) {
+    return position > INT_MAX ? INT_MAX : (int)position;
+}
+
+/**
+ * @brief Apply the operator on top of opStack, without printing
+ * @param numStack Number stack
+ * @param opStack Operator stack
+ * @param posStack Position of every operator in opStack
+ * @param errorPos Receives the position of the failing operator
+ * @return CALC_OK or the error performOperation would have printed
+ */
+static CalcStatus applyOperator(LinkedStack* numStack, LinkedStack* opStack, LinkedStack* posStack, long long* errorPos) {
+    int num1, num2, op, pos;
+
+    stackTop(opStack, &op);
+    stackPop(opStack);
+    stackTop(posStack, &pos);
+    stackPop(posStack);
+
+    if (stackSize(numStack) < 2) {
+        *errorPos = pos;
+        return CALC_ERR_OPERAND;
+    }
+
+    stackTop(numStack, &num2);
+    stackPop(numStack);
+    stackTop(numStack, &num1);
+    stackPop(numStack);
+
+    switch ((char)op) {
+        case '+':
+            return stackPush(numStack, num1 + num2) ? CALC_OK : CALC_ERR_MEMORY;
+        case '-':
+            return stackPush(numStack, num1 - num2) ? CALC_OK : CALC_ERR_MEMORY;
+        case '*':
+            return stackPush(numStack, num1 * num2) ? CALC_OK : CALC_ERR_MEMORY;
+        case '/':
+            if (num2 == 0) {
+                *errorPos = pos;
+                return CALC_ERR_DIV_ZERO;
+            }
+            if (num2 == -1) {
+                // INT_MIN / -1 would trap and take the whole process down, negate with wraparound
+                return stackPush(numStack, (int)(0u - (unsigned)num1)) ? CALC_OK : CALC_ERR_MEMORY;
+            }
+            return stackPush(numStack, num1 / num2) ? CALC_OK : CALC_ERR_MEMORY;
+        default:
+            *errorPos = pos;
+            return CALC_ERR_FORMAT;
+    }
+}
+
+/**
+ * @brief Push an operator together with its position
+ */
+static CalcStatus pushOperator(LinkedStack* opStack, LinkedStack* posStack, char op, long long pos) {
+    if (!stackPush(opStack, (int)op)) {
+        return CALC_ERR_MEMORY;
+    }
+    if (!stackPush(posStack, stackPosition(pos))) {
+        stackPop(opStack);
+        return CALC_ERR_MEMORY;
+    }
+    return CALC_OK;
+}
+
+CalcStatus evaluateStream(CalcReader* reader, int* result, long long* errorPos) {
+    LinkedStack numStack;  // Number stack
+    LinkedStack opStack;   // Operator stack
+    LinkedStack posStack;  // Position of each operator, for error reporting
+    CalcStatus status = CALC_OK;  // First evaluation error, syntax errors still win over it
+    long long statusPos = -1;
+    int parenCount = 0;
+    bool lastWasOp = true; // Expression start is considered as preceding an operator
+    CalcToken token;
+    int op;
+
+    stackInit(&numStack);
+    stackInit(&opStack);
+    stackInit(&posStack);
+
+    for (scanToken(reader, &token); token.type != CALC_TOKEN_END; scanToken(reader, &token)) {
+        char ch = (char)token.value;
+
+        if (token.type == CALC_TOKEN_NUMBER) {
+            if (status == CALC_OK && !stackPush(&numStack, token.value)) {
+                status = CALC_ERR_MEMORY;
+                statusPos = token.position;
+            }
+            lastWasOp = false;
+        } else if (token.type == CALC_TOKEN_LPAREN) {
+            parenCount++;
+            if (status == CALC_OK) {
+                status = pushOperator(&opStack, &posStack, ch, token.position);
+                statusPos = token.position;
+            }
+            lastWasOp = true;
+        } else if (token.type == CALC_TOKEN_RPAREN) {
+            if (--parenCount < 0) {
+                statusPos = token.position;
+                status = CALC_ERR_SYNTAX;  // Parentheses do not match
+                break;
+            }
+            // Calculate all operations within parentheses
+            while (status == CALC_OK && !stackIsEmpty(&opStack)) {
+                stackTop(&opStack, &op);
+                if (op == '(') {
+                    stackPop(&opStack);
+                    stackPop(&posStack);
+                    break;
+                }
+                status = applyOperator(&numStack, &opStack, &posStack, &statusPos);
+            }
+            lastWasOp = false;
+        } else if (token.type == CALC_TOKEN_OPERATOR) {
+            if (lastWasOp && ch != '+' && ch != '-') {
+                statusPos = token.position;
+                status = CALC_ERR_SYNTAX;  // No consecutive non-positive/negative sign operators allowed
+                break;
+            }
+            if (status == CALC_OK) {
+                if (lastWasOp) {
+                    // Unary minus becomes 0 - x, unary plus is dropped
+                    if (ch == '-') {
+                        status = stackPush(&numStack, 0) ? pushOperator(&opStack, &posStack, ch, token.position)
+                                                         : CALC_ERR_MEMORY;
+                        statusPos = token.position;
+                    }
+                } else {
+                    while (status == CALC_OK && !stackIsEmpty(&opStack)) {
+                        stackTop(&opStack, &op);
+                        if (op == '(' || getPriority(ch) > getPriority((char)op)) {
+                            break;
+                        }
+                        status = applyOperator(&numStack, &opStack, &posStack, &statusPos);
+                    }
+                    if (status == CALC_OK) {
+                        status = pushOperator(&opStack, &posStack, ch, token.position);
+                        statusPos = token.position;
+                    }
+                }
+            }
+            lastWasOp = true;
+        } else {
+            statusPos = token.position;
+            status = CALC_ERR_SYNTAX;  // Invalid character
+            break;
+        }
+    }
+
+    // Unclosed parenthesis or trailing operator, reported at the end of the input
+    if (status != CALC_ERR_SYNTAX && (parenCount != 0 || lastWasOp)) {
+        statusPos = token.position;
+        status = CALC_ERR_SYNTAX;
+    }
+
+    // Process remaining operators
+    while (status == CALC_OK && !stackIsEmpty(&opStack)) {
+        stackTop(&opStack, &op);
+        if (op == '(') {
+            int pos;
+            stackTop(&posStack, &pos);
+            statusPos = pos;
+            status = CALC_ERR_PAREN;
+            break;
+        }
+        status = applyOperator(&numStack, &opStack, &posStack, &statusPos);
+    }
+
+    if (status == CALC_OK) {
+        if (stackSize(&numStack) == 1) {
+            stackTop(&numStack, result);
+        } else {
+            statusPos = token.position;
+            status = CALC_ERR_FORMAT;
+        }
+    }
+
+    if (status != CALC_OK && errorPos != NULL) {
+        *errorPos = statusPos;
+    }
+    stackDestroy(&numStack);
+    stackDestroy(&opStack);
+    stackDestroy(&posStack);
+    calcReaderNextLine(reader);
+    return status;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file jitDiffTest.c
+ * @brief Differential test of calcJitRun against runProgramWith and evaluateAstWith
+ * @note Usage: jitDiffTest [formulas]
+ *       Random formulas over three variables are compiled once for every path and run with
+ *       random values mixed with edge values, INT_MIN / -1 among them. Every status and every
+ *       result must agree. Exits 1 on the first difference.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "../Include/calculator.h"
+#include "../Include/calcBytecode.h"
+#include "../Include/calcAst.h"
+#include "../Include/calcJit.h"
+
+#define DEFAULT_FORMULAS 20000
+#define VALUE_SETS 16
+
+static const char* const names[] = {"a", "b", "c"};
+static const int edgeValues[] = {0, 1, -1, 2, -2, 7, INT_MIN, INT_MAX, INT_MIN + 1};
+
+static unsigned long long rngState = 0x2545F4914F6CDD1Dull;
+
+/**
+ * @brief xorshift64
+ */
+static unsigned nextRandom(void) {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (unsigned)(rngState >> 32);
+}
+
+static int randomValue(void) {
+    if (nextRandom() % 2 == 0) {
+        return edgeValues[nextRandom() % (sizeof(edgeValues) / sizeof(edgeValues[0]))];
+    }
+    return (int)(nextRandom() % 2001) - 1000;
+}
+
+/**
+ * @brief Append a random expression of at most depth levels to text
+ */
+static void randomFormula(char* text, size_t* length, int depth) {
+    static const char ops[] = "+-*/";
+    unsigned kind = depth == 0 ? nextRandom() % 2 : nextRandom() % 5;
+
+    switch (kind) {
+        case 0:
+            *length += (size_t)sprintf(text + *length, "%s", names[nextRandom() % 3]);
+            break;
+        case 1:
+            *length += (size_t)sprintf(text + *length, "%u", nextRandom() % 4);
+            break;
+        case 2:
+            text[(*length)++] = '-';
+            randomFormula(text, length, depth - 1);
+            break;
+        default:
+            text[(*length)++] = '(';
+            randomFormula(text, length, depth - 1);
+            text[(*length)++] = ops[nextRandom() % 4];
+            randomFormula(text, length, depth - 1);
+            text[(*length)++] = ')';
+            break;
+    }
+    text[*length] = '\0';
+}
+
+/**
+ * @brief Run one formula on every path with one set of values
+ * @return true if all paths agree
+ */
+static bool agree(const char* text, const CalcJit* jit, const CalcProgram* program, const CalcAst* ast,
+                  const int* values) {
+    int results[3] = {0, 0, 0};
+    CalcStatus status[3];
+
+    status[0] = calcJitRun(jit, values, &results[0]);
+    status[1] = runProgramWith(program, values, &results[1]);
+    status[2] = evaluateAstWith(ast, values, &results[2]);
+    for (int k = 1; k < 3; k++) {
+        if (status[k] != status[0] || (status[0] == CALC_OK && results[k] != results[0])) {
+            fprintf(stderr, "%s with a=%d b=%d c=%d: jit %d/%d, bytecode %d/%d, dag %d/%d\n",
+                    text, values[0], values[1], values[2], status[0], results[0],
+                    status[1], results[1], status[2], results[2]);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Compile text for every path and check it on the given value sets
+ */
+static bool check(const char* text, const int (*valueSets)[3], int count) {
+    CalcProgram program;
+    CalcAst ast;
+    CalcJit jit;
+    bool ok = true;
+
+    if (calcJitCompile(text, names, 3, &jit) != CALC_OK) {
+        fprintf(stderr, "cannot compile %s\n", text);
+        return false;
+    }
+    compileWithVariables(text, names, 3, &program);
+    compileAstWithVariables(text, names, 3, &ast);
+    for (int v = 0; v < count && ok; v++) {
+        ok = agree(text, &jit, &program, &ast, valueSets[v]);
+    }
+    calcJitFree(&jit);
+    freeProgram(&program);
+    freeAst(&ast);
+    return ok;
+}
+
+int main(int argc, char* argv[]) {
+    long formulas = argc > 1 ? atol(argv[1]) : DEFAULT_FORMULAS;
+    // INT_MIN / -1 through the fused and the stack-operand divide, and a zero divisor
+    static const char* const fixed[] = {"a/b", "(c+a)/b", "a/(b*1)", "a/-1", "a/(0-1)", "a/c"};
+    static const int edgeSets[][3] = {{INT_MIN, -1, 0}, {INT_MAX, -1, 1}, {-7, 2, -1}};
+    int valueSets[VALUE_SETS][3];
+    char text[1024];
+
+    for (size_t f = 0; f < sizeof(fixed) / sizeof(fixed[0]); f++) {
+        if (!check(fixed[f], edgeSets, 3)) {
+            return 1;
+        }
+    }
+
+    for (long n = 0; n < formulas; n++) {
+        size_t length = 0;
+        randomFormula(text, &length, 5);
+        for (int v = 0; v < VALUE_SETS; v++) {
+            for (int k = 0; k < 3; k++) {
+                valueSets[v][k] = randomValue();
+            }
+        }
+        if (!check(text, (const int (*)[3])valueSets, VALUE_SETS)) {
+            return 1;
+        }
+    }
+
+    printf("%ld random formulas and %zu fixed ones agree on jit, bytecode and dag\n",
+           formulas, sizeof(fixed) / sizeof(fixed[0]));
+    return 0;
+}
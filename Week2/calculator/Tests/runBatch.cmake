@@ -0,0 +1,11 @@
+# Run the batch mode on INPUT and compare its standard output with EXPECTED
+execute_process(COMMAND ${CALC} --batch ${INPUT} - 1
+                OUTPUT_VARIABLE actual
+                RESULT_VARIABLE result)
+file(READ ${EXPECTED} expected)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "calc --batch exited with ${result}")
+endif()
+if(NOT actual STREQUAL expected)
+    message(FATAL_ERROR "Output differs from ${EXPECTED}:\n${actual}")
+endif()
@@ -0,0 +1,146 @@
+/**
+ * @file lockFreeStackBench.c
+ * @brief Contention benchmark: LockFreeStack against a LinkedStack behind one mutex
+ * @note Usage: lockFreeStackBench [maxThreads] [opsPerThread]
+ *       Every thread pushes a burst of values and pops the same number back, as a
+ *       shared work pool does. The sum of all popped values is checked against the
+ *       sum of all pushed values.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <stdatomic.h>
+#include "../Include/linkedStack.h"
+#include "../Include/lockFreeStack.h"
+
+#define DEFAULT_OPS 1000000L
+#define BURST 8
+#define MAX_THREADS 64
+
+typedef struct {
+    LockFreeStack* lockFree;
+    LinkedStack* locked;
+    pthread_mutex_t* lock;
+    int id;
+    long ops;
+    long long pushed;
+    long long popped;
+} Worker;
+
+/**
+ * @brief Monotonic clock in seconds
+ */
+static double nowSeconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void* lockFreeWorker(void* arg) {
+    Worker* w = (Worker*)arg;
+    StackElement value;
+
+    for (long i = 0; i < w->ops; i += 2 * BURST) {
+        for (int k = 0; k < BURST; k++) {
+            StackElement v = (StackElement)(w->id * 1000 + k);
+            lfStackPush(w->lockFree, v);
+            w->pushed += v;
+        }
+        for (int k = 0; k < BURST; k++) {
+            if (lfStackTryPop(w->lockFree, &value)) {
+                w->popped += value;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void* mutexWorker(void* arg) {
+    Worker* w = (Worker*)arg;
+    StackElement value;
+
+    for (long i = 0; i < w->ops; i += 2 * BURST) {
+        for (int k = 0; k < BURST; k++) {
+            StackElement v = (StackElement)(w->id * 1000 + k);
+            pthread_mutex_lock(w->lock);
+            stackPush(w->locked, v);
+            pthread_mutex_unlock(w->lock);
+            w->pushed += v;
+        }
+        for (int k = 0; k < BURST; k++) {
+            pthread_mutex_lock(w->lock);
+            if (stackTop(w->locked, &value)) {
+                stackPop(w->locked);
+                w->popped += value;
+            }
+            pthread_mutex_unlock(w->lock);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Run fn on n threads, drain what is left and check the sums
+ * @return Millions of operations per second, negative if the sums differ
+ */
+static double runMode(int n, long ops, void* (*fn)(void*), LockFreeStack* lockFree, LinkedStack* locked) {
+    pthread_t tids[MAX_THREADS];
+    Worker workers[MAX_THREADS];
+    pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    long long pushed = 0, popped = 0;
+    StackElement value;
+    double elapsed = nowSeconds();
+
+    for (int i = 0; i < n; i++) {
+        workers[i] = (Worker){lockFree, locked, &lock, i, ops, 0, 0};
+        pthread_create(&tids[i], NULL, fn, &workers[i]);
+    }
+    for (int i = 0; i < n; i++) {
+        pthread_join(tids[i], NULL);
+        pushed += workers[i].pushed;
+        popped += workers[i].popped;
+    }
+    elapsed = nowSeconds() - elapsed;
+
+    while (lfStackTryPop(lockFree, &value)) {
+        popped += value;
+    }
+    while (stackTop(locked, &value)) {
+        stackPop(locked);
+        popped += value;
+    }
+
+    return pushed == popped ? n * ops / elapsed / 1e6 : -1.0;
+}
+
+int main(int argc, char* argv[]) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = argc > 1 ? atoi(argv[1]) : (int)(cores < 4 ? 4 : cores);
+    long ops = argc > 2 ? atol(argv[2]) : DEFAULT_OPS;
+    LockFreeStack lockFree;
+    LinkedStack locked;
+
+    if (maxThreads > MAX_THREADS) {
+        maxThreads = MAX_THREADS;
+    }
+    lfStackInit(&lockFree);
+    stackInit(&locked);
+
+    printf("%8s %16s %16s\n", "threads", "lock-free Mops/s", "mutex Mops/s");
+    for (int n = 1; n <= maxThreads; n *= 2) {
+        double lf = runMode(n, ops, lockFreeWorker, &lockFree, &locked);
+        double mx = runMode(n, ops, mutexWorker, &lockFree, &locked);
+        if (lf < 0 || mx < 0) {
+            fprintf(stderr, "pushed and popped sums differ at %d threads\n", n);
+            return 1;
+        }
+        printf("%8d %16.2f %16.2f\n", n, lf, mx);
+    }
+
+    lfStackDestroy(&lockFree);
+    stackDestroy(&locked);
+    return 0;
+}
@@ -13,6 +13,49 @@
  */
 typedef int StackElement;
 
+/**
+ * @brief 直接存放在栈结构体内的元素个数，编译时定义为0则关闭
+ * @note 前STACK_INLINE_CAPACITY个元素不分配堆内存，超出部分才按原方式分配，
+ *       表达式求值这类浅栈因此完全不分配内存
+ */
+#ifndef STACK_INLINE_CAPACITY
+#define STACK_INLINE_CAPACITY 32
+#endif
+
+#ifdef LINKED_STACK_ARRAY
+
+/**
+ * @brief 首次压栈时分配的数组容量
+ */
+#define STACK_INITIAL_CAPACITY 16
+
+/**
+ * @brief 栈结构体（数组实现，编译时定义LINKED_STACK_ARRAY启用）
+ * @note 容量不足时成倍扩容，压栈和弹栈都不再逐次分配内存。
+ *       数组起初指向内置存储，因此栈初始化后不能按值复制
+ */
+typedef struct {
+    StackElement* items;       /**< 元素数组，items[size - 1]为栈顶 */
+    int size;                  /**< 栈中元素的数量 */
+    int capacity;              /**< 数组容量 */
+#if STACK_INLINE_CAPACITY > 0
+    StackElement inlineItems[STACK_INLINE_CAPACITY];  /**< 内置存储，溢出前items指向这里 */
+#endif
+} LinkedStack;
+
+#else
+
+/**
+ * @brief 每个线程最多缓存的空闲节点数，编译时定义为0则关闭节点回收
+ * @note 弹出的节点先放入本线程的缓存，压栈时优先复用，超过上限的节点直接释放。
+ *       上限按线程计算，N个线程最多共缓存N * STACK_NODE_CACHE_MAX个节点；
+ *       线程退出时其缓存由pthread键的析构函数释放，主线程的缓存在进程结束时由系统回收。
+ *       缓存只属于一个线程，在A线程弹出的节点只能被A线程之后的压栈复用
+ */
+#ifndef STACK_NODE_CACHE_MAX
+#define STACK_NODE_CACHE_MAX 4096
+#endif
+
 /**
  * @brief 栈节点结构体
  */
@@ -23,12 +66,18 @@ typedef struct StackNode {
 
 /**
  * @brief 栈结构体
+ * @note 栈底的STACK_INLINE_CAPACITY个元素存放在inlineItems中，更上面的元素才是链表节点
  */
 typedef struct {
-    StackNode* top;            /**< 指向栈顶的指针 */
+    StackNode* top;            /**< 指向最上面的链表节点，元素未超出内置存储时为NULL */
     int size;                  /**< 栈中元素的数量 */
+#if STACK_INLINE_CAPACITY > 0
+    StackElement inlineItems[STACK_INLINE_CAPACITY];  /**< 内置存储，inlineItems[0]为栈底 */
+#endif
 } LinkedStack;
 
+#endif /* LINKED_STACK_ARRAY */
+
 /**
  * @brief 初始化栈
  * @param stack 指向栈的指针
@@ -84,4 +133,11 @@ void stackClear(LinkedStack* stack);
  */
 void stackDestroy(LinkedStack* stack);
 
+/**
+ * @brief 把空闲内存还给系统
+ * @param stack 指向栈的指针
+ * @note 数组实现收缩到恰好容纳现有元素；链表实现释放本线程缓存的空闲节点
+ */
+void stackShrink(LinkedStack* stack);
+
 #endif /* LINKED_STACK_H */ 
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+ * @file lockFreeStack.h
+ * @brief 无锁Treiber栈的接口定义，可在多个线程间共享
+ * @note 节点按下标从分块数组中分配，栈顶为“32位版本号 + 32位下标”打包成的64位字，
+ *       每次修改栈顶版本号加一，以此避免ABA问题；弹出的节点进入同样带版本号的空闲链表，
+ *       直到销毁栈时才释放内存
+ */
+
+#ifndef LOCK_FREE_STACK_H
+#define LOCK_FREE_STACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include "linkedStack.h"
+
+#define LF_STACK_CHUNK_BITS 16                          /**< 每块节点数的对数 */
+#define LF_STACK_CHUNK_SIZE (1u << LF_STACK_CHUNK_BITS) /**< 每块节点数 */
+#define LF_STACK_MAX_CHUNKS 4096                        /**< 块数上限，共约2.7亿个节点 */
+
+/**
+ * @brief 无锁栈节点，下标0表示空
+ */
+typedef struct LockFreeNode {
+    _Atomic StackElement data;       /**< 节点数据，可能被过期的弹出者并发读取 */
+    _Atomic uint32_t next;           /**< 下一个节点的下标 */
+} LockFreeNode;
+
+/**
+ * @brief 无锁栈结构体
+ */
+typedef struct {
+    _Atomic uint64_t top;                  /**< 栈顶：高32位版本号，低32位下标 */
+    _Atomic uint64_t freeTop;              /**< 空闲节点链表头，格式同top */
+    _Atomic uint32_t nextIndex;            /**< 尚未使用过的最小下标 */
+    atomic_int size;                       /**< 栈中元素的数量 */
+    _Atomic(LockFreeNode*)* chunks;        /**< 节点分块表 */
+} LockFreeStack;
+
+/**
+ * @brief 初始化栈
+ * @param stack 指向栈的指针
+ * @return 操作成功返回true，失败返回false
+ */
+bool lfStackInit(LockFreeStack* stack);
+
+/**
+ * @brief 检查栈是否为空
+ * @param stack 指向栈的指针
+ * @return 如果栈为空返回true，否则返回false
+ */
+bool lfStackIsEmpty(const LockFreeStack* stack);
+
+/**
+ * @brief 获取栈的大小
+ * @param stack 指向栈的指针
+ * @return 栈中元素的数量，并发修改时只是近似值
+ */
+int lfStackSize(const LockFreeStack* stack);
+
+/**
+ * @brief 将元素压入栈顶
+ * @param stack 指向栈的指针
+ * @param element 要压入栈的元素
+ * @return 操作成功返回true，失败返回false
+ */
+bool lfStackPush(LockFreeStack* stack, StackElement element);
+
+/**
+ * @brief 弹出栈顶元素
+ * @param stack 指向栈的指针
+ * @return 操作成功返回true，失败返回false
+ */
+bool lfStackPop(LockFreeStack* stack);
+
+/**
+ * @brief 弹出栈顶元素并取得其值
+ * @param stack 指向栈的指针
+ * @param element 用于存储弹出元素的指针
+ * @return 操作成功返回true，栈为空返回false
+ * @note 多线程下先stackTop再stackPop不是原子的，工作池应使用本函数
+ */
+bool lfStackTryPop(LockFreeStack* stack, StackElement* element);
+
+/**
+ * @brief 获取栈顶元素
+ * @param stack 指向栈的指针
+ * @param element 用于存储栈顶元素的指针
+ * @return 操作成功返回true，失败返回false
+ */
+bool lfStackTop(const LockFreeStack* stack, StackElement* element);
+
+/**
+ * @brief 销毁栈，释放所有节点
+ * @param stack 指向栈的指针
+ * @note 调用时不能有其他线程在使用该栈
+ */
+void lfStackDestroy(LockFreeStack* stack);
+
+#endif /* LOCK_FREE_STACK_H */
@@ -0,0 +1,207 @@
+/**
+ * @file arrayStack.c
+ * @brief 基于数组的栈实现，接口与linkedStack.h相同
+ * @note 编译时定义LINKED_STACK_ARRAY启用，此时linkedStack.c不参与编译
+ */
+
+#include "linkedStack.h"
+#include "containerStats.h"
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#ifdef LINKED_STACK_ARRAY
+
+/**
+ * @brief 让栈回到只使用内置存储的状态
+ * @param stack 指向栈的指针
+ */
+static void useInlineItems(LinkedStack* stack) {
+#if STACK_INLINE_CAPACITY > 0
+    stack->items = stack->inlineItems;
+    stack->capacity = STACK_INLINE_CAPACITY;
+#else
+    stack->items = NULL;
+    stack->capacity = 0;
+#endif
+}
+
+/**
+ * @brief 检查数组是否为堆上分配
+ * @param stack 指向栈的指针
+ */
+static bool itemsOnHeap(const LinkedStack* stack) {
+#if STACK_INLINE_CAPACITY > 0
+    return stack->items != stack->inlineItems;
+#else
+    return stack->items != NULL;
+#endif
+}
+
+/**
+ * @brief 初始化栈
+ * @param stack 指向栈的指针
+ * @note 先使用内置存储，超出后数组才在堆上分配
+ */
+void stackInit(LinkedStack* stack) {
+    assert(stack != NULL);
+
+    stack->size = 0;
+    useInlineItems(stack);
+}
+
+/**
+ * @brief 检查栈是否为空
+ * @param stack 指向栈的指针
+ * @return 如果栈为空返回true，否则返回false
+ */
+bool stackIsEmpty(const LinkedStack* stack) {
+    assert(stack != NULL);
+
+    return stack->size == 0;
+}
+
+/**
+ * @brief 获取栈的大小
+ * @param stack 指向栈的指针
+ * @return 栈中元素的数量
+ */
+int stackSize(const LinkedStack* stack) {
+    assert(stack != NULL);
+
+    return stack->size;
+}
+
+/**
+ * @brief 将元素压入栈顶
+ * @param stack 指向栈的指针
+ * @param element 要压入栈的元素
+ * @return 操作成功返回true，失败返回false
+ */
+bool stackPush(LinkedStack* stack, StackElement element) {
+    assert(stack != NULL);
+
+    if (stack->size == stack->capacity) {
+        // 容量不足时成倍扩容，均摊O(1)
+        int capacity = stack->capacity == 0 ? STACK_INITIAL_CAPACITY : stack->capacity * 2;
+        StackElement* items;
+        if (itemsOnHeap(stack)) {
+            items = (StackElement*)realloc(stack->items, (size_t)capacity * sizeof(StackElement));
+        } else {
+            // 第一次溢出内置存储，把已有元素搬到堆上
+            items = (StackElement*)malloc((size_t)capacity * sizeof(StackElement));
+            if (items != NULL && stack->size > 0) {
+                memcpy(items, stack->items, (size_t)stack->size * sizeof(StackElement));
+            }
+        }
+        if (items == NULL) {
+            return false;  // 内存分配失败，原数组保持不变
+        }
+        // realloc记作释放旧数组、分配新数组
+        if (itemsOnHeap(stack)) {
+            STATS_FREE(STATS_LINKED_STACK, 1, (size_t)stack->capacity * sizeof(StackElement));
+        }
+        STATS_ALLOC(STATS_LINKED_STACK, 1, (size_t)capacity * sizeof(StackElement));
+        stack->items = items;
+        stack->capacity = capacity;
+    }
+
+    stack->items[stack->size++] = element;
+    STATS_DEPTH(STATS_LINKED_STACK, stack->size);
+    return true;
+}
+
+/**
+ * @brief 弹出栈顶元素
+ * @param stack 指向栈的指针
+ * @return 操作成功返回true，失败返回false
+ */
+bool stackPop(LinkedStack* stack) {
+    assert(stack != NULL);
+
+    if (stackIsEmpty(stack)) {
+        return false;  // 栈为空，无法弹出元素
+    }
+
+    stack->size--;
+    return true;
+}
+
+/**
+ * @brief 获取栈顶元素
+ * @param stack 指向栈的指针
+ * @param element 用于存储栈顶元素的指针
+ * @return 操作成功返回true，失败返回false
+ */
+bool stackTop(const LinkedStack* stack, StackElement* element) {
+    assert(stack != NULL);
+    assert(element != NULL);
+
+    if (stackIsEmpty(stack)) {
+        return false;  // 栈为空，无法获取栈顶元素
+    }
+
+    *element = stack->items[stack->size - 1];
+    return true;
+}
+
+/**
+ * @brief 清空栈
+ * @param stack 指向栈的指针
+ * @note 保留已分配的数组，供之后复用
+ */
+void stackClear(LinkedStack* stack) {
+    assert(stack != NULL);
+
+    stack->size = 0;
+}
+
+/**
+ * @brief 销毁栈
+ * @param stack 指向栈的指针
+ */
+void stackDestroy(LinkedStack* stack) {
+    assert(stack != NULL);
+
+    if (itemsOnHeap(stack)) {
+        free(stack->items);
+        STATS_FREE(STATS_LINKED_STACK, 1, (size_t)stack->capacity * sizeof(StackElement));
+    }
+    stack->size = 0;
+    useInlineItems(stack);
+}
+
+/**
+ * @brief 把空闲内存还给系统
+ * @param stack 指向栈的指针
+ * @note 数组收缩到恰好容纳现有元素，放得进内置存储时释放整个堆数组
+ */
+void stackShrink(LinkedStack* stack) {
+    assert(stack != NULL);
+
+    if (!itemsOnHeap(stack)) {
+        return;
+    }
+    if (stack->size <= STACK_INLINE_CAPACITY) {
+        StackElement* items = stack->items;
+        STATS_FREE(STATS_LINKED_STACK, 1, (size_t)stack->capacity * sizeof(StackElement));
+        useInlineItems(stack);
+        if (stack->size > 0) {
+            memcpy(stack->items, items, (size_t)stack->size * sizeof(StackElement));
+        }
+        free(items);
+        return;
+    }
+
+    if (stack->size < stack->capacity) {
+        StackElement* items = (StackElement*)realloc(stack->items, (size_t)stack->size * sizeof(StackElement));
+        if (items != NULL) {
+            STATS_FREE(STATS_LINKED_STACK, 1, (size_t)stack->capacity * sizeof(StackElement));
+            STATS_ALLOC(STATS_LINKED_STACK, 1, (size_t)stack->size * sizeof(StackElement));
+            stack->items = items;
+            stack->capacity = stack->size;
+        }
+    }
+}
+
+#endif /* LINKED_STACK_ARRAY */
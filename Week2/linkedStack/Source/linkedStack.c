@@ -4,9 +4,119 @@
  */
 
 #include "linkedStack.h"
+#include "containerStats.h"
 #include <stdlib.h>
 #include <assert.h>
 
+#ifndef LINKED_STACK_ARRAY
+
+// 节点缓存按线程划分，不同线程的栈互不干扰，也无需加锁
+#if STACK_NODE_CACHE_MAX > 0
+#if defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+#define STACK_THREAD_LOCAL _Thread_local
+#elif defined(__GNUC__)
+#define STACK_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define STACK_THREAD_LOCAL __declspec(thread)
+#endif
+#endif
+
+#ifdef STACK_THREAD_LOCAL
+static STACK_THREAD_LOCAL StackNode* nodeCache = NULL;   /**< 本线程的空闲节点链表 */
+static STACK_THREAD_LOCAL int cachedNodes = 0;           /**< 缓存中的节点数 */
+
+/**
+ * @brief 释放本线程缓存的全部空闲节点
+ */
+static void drainCache(void) {
+    STATS_FREE(STATS_LINKED_STACK, cachedNodes, (size_t)cachedNodes * sizeof(StackNode));
+    while (nodeCache != NULL) {
+        StackNode* temp = nodeCache;
+        nodeCache = nodeCache->next;
+        free(temp);
+    }
+    cachedNodes = 0;
+}
+
+#ifndef _MSC_VER
+#include <pthread.h>
+#define STACK_CACHE_EXIT_KEY
+
+// 线程退出时由键的析构函数清空缓存，否则缓存的节点随线程一起泄漏
+static STACK_THREAD_LOCAL bool cacheRegistered = false;  /**< 本线程是否已登记析构函数 */
+static pthread_once_t keyOnce = PTHREAD_ONCE_INIT;
+static pthread_key_t exitKey;
+static bool keyCreated = false;
+
+/**
+ * @brief 线程退出：释放该线程缓存的节点
+ */
+static void releaseCache(void* cache) {
+    (void)cache;
+    drainCache();
+}
+
+static void createKey(void) {
+    keyCreated = pthread_key_create(&exitKey, releaseCache) == 0;
+}
+
+/**
+ * @brief 线程第一次缓存节点时登记，之后只多一次线程局部变量的判断
+ * @return 登记成功返回true；失败时不缓存，节点直接释放
+ */
+static bool registerCache(void) {
+    pthread_once(&keyOnce, createKey);
+    // 值只需非NULL，析构函数才会被调用
+    if (!keyCreated || pthread_setspecific(exitKey, &nodeCache) != 0) {
+        return false;
+    }
+    cacheRegistered = true;
+    return true;
+}
+#endif
+#endif
+
+/**
+ * @brief 取得一个节点，优先复用本线程缓存中的节点
+ * @return 节点指针，内存分配失败返回NULL
+ */
+static StackNode* allocNode(void) {
+#ifdef STACK_THREAD_LOCAL
+    if (nodeCache != NULL) {
+        StackNode* node = nodeCache;
+        nodeCache = node->next;
+        cachedNodes--;
+        return node;
+    }
+#endif
+    StackNode* node = (StackNode*)malloc(sizeof(StackNode));
+    if (node != NULL) {
+        STATS_ALLOC(STATS_LINKED_STACK, 1, sizeof(StackNode));
+    }
+    return node;
+}
+
+/**
+ * @brief 归还一个节点，缓存未满时留给之后的压栈复用
+ * @param node 要归还的节点
+ */
+static void freeNode(StackNode* node) {
+#ifdef STACK_THREAD_LOCAL
+#ifdef STACK_CACHE_EXIT_KEY
+    if (cachedNodes < STACK_NODE_CACHE_MAX && (cacheRegistered || registerCache())) {
+#else
+    if (cachedNodes < STACK_NODE_CACHE_MAX) {
+#endif
+        node->next = nodeCache;
+        nodeCache = node;
+        cachedNodes++;
+        return;
+    }
+#endif
+    free(node);
+    STATS_FREE(STATS_LINKED_STACK, 1, sizeof(StackNode));
+}
+
 /**
  * @brief 初始化栈
  * @param stack 指向栈的指针
@@ -26,7 +136,7 @@ void stackInit(LinkedStack* stack) {
 bool stackIsEmpty(const LinkedStack* stack) {
     assert(stack != NULL);
     
-    return stack->top == NULL;
+    return stack->size == 0;
 }
 
 /**
@@ -49,7 +159,16 @@ int stackSize(const LinkedStack* stack) {
 bool stackPush(LinkedStack* stack, StackElement element) {
     assert(stack != NULL);
     
-    StackNode* newNode = (StackNode*)malloc(sizeof(StackNode));
+#if STACK_INLINE_CAPACITY > 0
+    // 内置存储未满时直接放入，不分配节点
+    if (stack->size < STACK_INLINE_CAPACITY) {
+        stack->inlineItems[stack->size++] = element;
+        STATS_DEPTH(STATS_LINKED_STACK, stack->size);
+        return true;
+    }
+#endif
+    
+    StackNode* newNode = allocNode();
     if (newNode == NULL) {
         return false;  // 内存分配失败
     }
@@ -58,6 +177,7 @@ bool stackPush(LinkedStack* stack, StackElement element) {
     newNode->next = stack->top;
     stack->top = newNode;
     stack->size++;
+    STATS_DEPTH(STATS_LINKED_STACK, stack->size);
     
     return true;
 }
@@ -74,9 +194,16 @@ bool stackPop(LinkedStack* stack) {
         return false;  // 栈为空，无法弹出元素
     }
     
+#if STACK_INLINE_CAPACITY > 0
+    if (stack->size <= STACK_INLINE_CAPACITY) {
+        stack->size--;
+        return true;
+    }
+#endif
+    
     StackNode* temp = stack->top;
     stack->top = stack->top->next;
-    free(temp);
+    freeNode(temp);
     stack->size--;
     
     return true;
@@ -96,6 +223,13 @@ bool stackTop(const LinkedStack* stack, StackElement* element) {
         return false;  // 栈为空，无法获取栈顶元素
     }
     
+#if STACK_INLINE_CAPACITY > 0
+    if (stack->size <= STACK_INLINE_CAPACITY) {
+        *element = stack->inlineItems[stack->size - 1];
+        return true;
+    }
+#endif
+    
     *element = stack->top->data;
     return true;
 }
@@ -107,9 +241,13 @@ bool stackTop(const LinkedStack* stack, StackElement* element) {
 void stackClear(LinkedStack* stack) {
     assert(stack != NULL);
     
-    while (!stackIsEmpty(stack)) {
-        stackPop(stack);
+    // 只有链表节点需要归还，内置存储中的元素直接丢弃
+    while (stack->top != NULL) {
+        StackNode* temp = stack->top;
+        stack->top = temp->next;
+        freeNode(temp);
     }
+    stack->size = 0;
 }
 
 /**
@@ -121,4 +259,21 @@ void stackDestroy(LinkedStack* stack) {
     
     stackClear(stack);
     // 栈结构本身通常由调用者负责释放，这里只清理节点
-} 
\ No newline at end of file
+}
+
+/**
+ * @brief 把空闲内存还给系统
+ * @param stack 指向栈的指针
+ * @note 释放本线程缓存的全部空闲节点，栈中现有元素不受影响；
+ *       线程退出时缓存会自动释放，长期运行的线程想提前归还内存时调用
+ */
+void stackShrink(LinkedStack* stack) {
+    assert(stack != NULL);
+    (void)stack;
+
+#ifdef STACK_THREAD_LOCAL
+    drainCache();
+#endif
+}
+
+#endif /* LINKED_STACK_ARRAY */
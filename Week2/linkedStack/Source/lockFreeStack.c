@@ -0,0 +1,182 @@
+/**
+ * @file lockFreeStack.c
+ * @brief 无锁Treiber栈实现
+ */
+
+#include "lockFreeStack.h"
+#include <stdlib.h>
+#include <assert.h>
+
+#define INDEX_OF(word) ((uint32_t)((word) & 0xffffffffu))
+#define TAG_OF(word) ((uint32_t)((word) >> 32))
+#define PACK(tag, index) (((uint64_t)(tag) << 32) | (uint64_t)(index))
+
+/**
+ * @brief 由下标取得节点，下标从1开始
+ */
+static LockFreeNode* nodeAt(const LockFreeStack* stack, uint32_t index) {
+    uint32_t slot = index - 1;
+    LockFreeNode* chunk = atomic_load(&stack->chunks[slot >> LF_STACK_CHUNK_BITS]);
+    return &chunk[slot & (LF_STACK_CHUNK_SIZE - 1)];
+}
+
+/**
+ * @brief 从带版本号的链表头弹出一个节点下标
+ * @return 节点下标，链表为空时返回0
+ */
+static uint32_t popIndex(LockFreeStack* stack, _Atomic uint64_t* head) {
+    uint64_t old = atomic_load(head);
+
+    for (;;) {
+        uint32_t index = INDEX_OF(old);
+        if (index == 0) {
+            return 0;
+        }
+
+        // 读到的next可能已过期，但此时版本号也已变化，CAS必然失败
+        uint32_t next = atomic_load(&nodeAt(stack, index)->next);
+        if (atomic_compare_exchange_weak(head, &old, PACK(TAG_OF(old) + 1, next))) {
+            return index;
+        }
+    }
+}
+
+/**
+ * @brief 把节点下标压入带版本号的链表头
+ */
+static void pushIndex(LockFreeStack* stack, _Atomic uint64_t* head, uint32_t index) {
+    LockFreeNode* node = nodeAt(stack, index);
+    uint64_t old = atomic_load(head);
+
+    do {
+        atomic_store_explicit(&node->next, INDEX_OF(old), memory_order_relaxed);
+    } while (!atomic_compare_exchange_weak(head, &old, PACK(TAG_OF(old) + 1, index)));
+}
+
+/**
+ * @brief 取得一个空闲节点，优先复用，其次从分块中新取
+ * @return 节点下标，内存不足时返回0
+ */
+static uint32_t allocIndex(LockFreeStack* stack) {
+    uint32_t index = popIndex(stack, &stack->freeTop);
+    if (index != 0) {
+        return index;
+    }
+
+    index = atomic_fetch_add(&stack->nextIndex, 1);
+    uint32_t chunkNo = (index - 1) >> LF_STACK_CHUNK_BITS;
+    if (chunkNo >= LF_STACK_MAX_CHUNKS) {
+        return 0;  // 超出容量上限
+    }
+
+    // 第一个用到新块的线程负责分配，竞争失败者释放自己的那份
+    if (atomic_load(&stack->chunks[chunkNo]) == NULL) {
+        LockFreeNode* fresh = (LockFreeNode*)calloc(LF_STACK_CHUNK_SIZE, sizeof(LockFreeNode));
+        LockFreeNode* expected = NULL;
+        if (fresh == NULL) {
+            return 0;  // 内存分配失败
+        }
+        if (!atomic_compare_exchange_strong(&stack->chunks[chunkNo], &expected, fresh)) {
+            free(fresh);
+        }
+    }
+    return index;
+}
+
+bool lfStackInit(LockFreeStack* stack) {
+    assert(stack != NULL);
+
+    stack->chunks = (_Atomic(LockFreeNode*)*)calloc(LF_STACK_MAX_CHUNKS, sizeof(*stack->chunks));
+    if (stack->chunks == NULL) {
+        return false;  // 内存分配失败
+    }
+    atomic_init(&stack->top, 0);
+    atomic_init(&stack->freeTop, 0);
+    atomic_init(&stack->nextIndex, 1);
+    atomic_init(&stack->size, 0);
+    return true;
+}
+
+bool lfStackIsEmpty(const LockFreeStack* stack) {
+    assert(stack != NULL);
+
+    return INDEX_OF(atomic_load(&stack->top)) == 0;
+}
+
+int lfStackSize(const LockFreeStack* stack) {
+    assert(stack != NULL);
+
+    return atomic_load(&stack->size);
+}
+
+bool lfStackPush(LockFreeStack* stack, StackElement element) {
+    assert(stack != NULL);
+
+    uint32_t index = allocIndex(stack);
+    if (index == 0) {
+        return false;  // 内存分配失败
+    }
+
+    atomic_store_explicit(&nodeAt(stack, index)->data, element, memory_order_relaxed);
+    pushIndex(stack, &stack->top, index);
+    atomic_fetch_add(&stack->size, 1);
+    return true;
+}
+
+bool lfStackTryPop(LockFreeStack* stack, StackElement* element) {
+    assert(stack != NULL);
+    assert(element != NULL);
+
+    uint64_t old = atomic_load(&stack->top);
+
+    for (;;) {
+        uint32_t index = INDEX_OF(old);
+        if (index == 0) {
+            return false;  // 栈为空
+        }
+
+        // 在CAS之前读出数据，CAS成功说明期间节点未被复用
+        LockFreeNode* node = nodeAt(stack, index);
+        StackElement value = atomic_load_explicit(&node->data, memory_order_relaxed);
+        uint32_t next = atomic_load(&node->next);
+        if (atomic_compare_exchange_weak(&stack->top, &old, PACK(TAG_OF(old) + 1, next))) {
+            *element = value;
+            pushIndex(stack, &stack->freeTop, index);
+            atomic_fetch_sub(&stack->size, 1);
+            return true;
+        }
+    }
+}
+
+bool lfStackPop(LockFreeStack* stack) {
+    StackElement ignored;
+
+    return lfStackTryPop(stack, &ignored);
+}
+
+bool lfStackTop(const LockFreeStack* stack, StackElement* element) {
+    assert(stack != NULL);
+    assert(element != NULL);
+
+    uint64_t old = atomic_load(&stack->top);
+    uint32_t index = INDEX_OF(old);
+    if (index == 0) {
+        return false;  // 栈为空，无法获取栈顶元素
+    }
+
+    *element = atomic_load_explicit(&nodeAt(stack, index)->data, memory_order_relaxed);
+    return true;
+}
+
+void lfStackDestroy(LockFreeStack* stack) {
+    assert(stack != NULL);
+
+    for (int i = 0; i < LF_STACK_MAX_CHUNKS; i++) {
+        free(atomic_load(&stack->chunks[i]));
+    }
+    free(stack->chunks);
+    stack->chunks = NULL;
+    atomic_store(&stack->top, 0);
+    atomic_store(&stack->freeTop, 0);
+    atomic_store(&stack->size, 0);
+}
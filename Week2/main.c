@@ -9,27 +9,63 @@
 #include <string.h>
 #include <ctype.h>
 #include <stdbool.h>
+#include <signal.h>
 #include "linkedStack/Include/linkedStack.h"
+#include "calculator/Include/calculator.h"
+#include "calculator/Include/calcBytecode.h"
+#include "calculator/Include/calcBatch.h"
+#include "calculator/Include/calcStream.h"
+#include "calculator/Include/calcAst.h"
+#include "calculator/Include/calcServer.h"
 
-#define MAX_EXPR_LEN 100    /**< Maximum expression length */
-#define ERROR_VALUE -999999  /**< Error value identifier */
+#define MAX_EXPR_LEN 100    /**< Prompt line buffer, longer lines are streamed */
+
+static volatile sig_atomic_t serverStop = 0;  /**< Set by SIGINT or SIGTERM in server mode */
 
 /* Function declarations */
-int calculateExpression(const char* expr);
-bool isOperator(char ch);
-int getPriority(char op);
-bool performOperation(LinkedStack* numStack, LinkedStack* opStack);
 void clearInputBuffer(void);
-bool isValidExpression(const char* expr);
+void evaluateLongLine(const char* prefix);
+CalcStatus evaluateWithAst(const char* expr, int* result);
+void stopServer(int sig);
+int serve(const char* address);
 
 /**
  * @brief Main function
+ * @param argc Argument count
+ * @param argv Arguments, "--batch <input> <output|-> [workers]" evaluates a file non-interactively,
+ *             "--ast" evaluates prompt input through the folded expression DAG,
+ *             "--serve <unix:path|tcp:port>" answers expressions sent over a local socket
  * @return Program exit status code
  */
-int main() {
+int main(int argc, char* argv[]) {
     char expr[MAX_EXPR_LEN];
     int result;
     bool continueCalc = true;
+    ProgramCache cache;
+    CalcStatus status;
+    bool useAst = argc > 1 && strcmp(argv[1], "--ast") == 0;
+    
+    // Batch mode: one expression per line in, one result per line out
+    if (argc >= 4 && strcmp(argv[1], "--batch") == 0) {
+        BatchStats stats;
+        if (!evaluateBatchFile(argv[2], argv[3], argc > 4 ? atoi(argv[4]) : 0, &stats)) {
+            fprintf(stderr, "Batch evaluation of %s failed\n", argv[2]);
+            return 1;
+        }
+        fprintf(stderr, "%ld expressions, %ld errors, %d workers, %.3f s\n",
+                stats.lines, stats.errors, stats.workers, stats.seconds);
+        return 0;
+    }
+    
+    // Server mode: newline-delimited expressions from local clients until SIGINT/SIGTERM
+    if (argc >= 3 && strcmp(argv[1], "--serve") == 0) {
+        return serve(argv[2]);
+    }
+    
+    if (!programCacheInit(&cache, PROGRAM_CACHE_CAPACITY)) {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
     
     printf("Welcome to the Arithmetic Calculator\n");
     printf("Supported operations: Addition(+), Subtraction(-), Multiplication(*), Division(/), Parentheses()\n");
@@ -42,6 +78,12 @@ int main() {
             continue;
         }
         
+        // The line did not fit, evaluate the rest of it straight from stdin
+        if (strchr(expr, '\n') == NULL && !feof(stdin)) {
+            evaluateLongLine(expr);
+            continue;
+        }
+        
         // Remove newline character
         expr[strcspn(expr, "\n")] = '\0';
         
@@ -58,290 +100,121 @@ int main() {
             continue;
         }
         
-        // Validate expression format
-        if (!isValidExpression(expr)) {
-            printf("Invalid expression format, please check and try again\n");
-            continue;
-        }
-        
-        // Calculate expression
-        result = calculateExpression(expr);
+        // Validate and calculate, repeated expressions reuse their compiled program
+        status = useAst ? evaluateWithAst(expr, &result) : evaluateCached(&cache, expr, &result);
         
         // Display result
-        if (result != ERROR_VALUE) {
+        if (status == CALC_OK) {
             printf("Result: %d\n", result);
         } else {
-            printf("Calculation error, please check your expression\n");
+            printf("%s\n", calcStatusMessage(status));
+            if (status == CALC_ERR_SYNTAX) {
+                // Only failed lines are scanned again, to locate the offending character
+                int errorPos = 0;
+                evaluateExpression(expr, &result, &errorPos);
+                printf("%s\n%*s^ position %d\n", expr, errorPos, "", errorPos + 1);
+            } else {
+                printf("Calculation error, please check your expression\n");
+            }
         }
     }
     
+    programCacheDestroy(&cache);
     return 0;
 }
 
 /**
- * @brief Validate expression format
- * @param expr Expression to validate
- * @return true if expression format is correct, false otherwise
+ * @brief Clear input buffer
  */
-bool isValidExpression(const char* expr) {
-    int i = 0;
-    int parenCount = 0;
-    bool lastWasOp = true; // Expression start is considered as preceding an operator
-    
-    while (expr[i] != '\0') {
-        if (isspace(expr[i])) {
-            i++;
-            continue;
-        }
-        
-        if (expr[i] == '(') {
-            parenCount++;
-            lastWasOp = true;
-        } else if (expr[i] == ')') {
-            parenCount--;
-            if (parenCount < 0) {
-                return false; // Parentheses do not match
-            }
-            lastWasOp = false;
-        } else if (isdigit(expr[i])) {
-            lastWasOp = false;
-            // Skip entire number
-            while (isdigit(expr[i])) {
-                i++;
-            }
-            continue;
-        } else if (isOperator(expr[i])) {
-            if (lastWasOp && expr[i] != '+' && expr[i] != '-') {
-                return false; // No consecutive non-positive/negative sign operators allowed
-            }
-            lastWasOp = true;
-        } else {
-            return false; // Invalid character
-        }
-        i++;
-    }
-    
-    return parenCount == 0 && !lastWasOp; // Parentheses must match, expression cannot end with an operator
+void clearInputBuffer(void) {
+    int c;
+    while ((c = getchar()) != '\n' && c != EOF);
 }
 
 /**
- * @brief Calculate expression value
- * @param expr Expression to calculate
- * @return Calculated result, ERROR_VALUE if calculation error
+ * @brief Evaluate a line longer than the prompt buffer
+ * @param prefix Part of the line already read
  */
-int calculateExpression(const char* expr) {
-    LinkedStack numStack;  // Number stack
-    LinkedStack opStack;   // Operator stack
-    int i = 0;
-    bool lastWasOp = true; // Used to determine positive/negative sign
-    int op, result;
-    
-    stackInit(&numStack);
-    stackInit(&opStack);
-    
-    while (expr[i] != '\0') {
-        // Skip spaces
-        if (isspace(expr[i])) {
-            i++;
-            continue;
-        }
-        
-        // Process number
-        if (isdigit(expr[i])) {
-            int num = 0;
-            while (isdigit(expr[i])) {
-                num = num * 10 + (expr[i] - '0');
-                i++;
-            }
-            stackPush(&numStack, num);
-            lastWasOp = false;
-            continue;
-        }
-        
-        // Process left parenthesis
-        if (expr[i] == '(') {
-            stackPush(&opStack, (int)'(');
-            lastWasOp = true;
-            i++;
-            continue;
-        }
-        
-        // Process right parenthesis
-        if (expr[i] == ')') {
-            // Calculate all operations within parentheses
-            while (!stackIsEmpty(&opStack)) {
-                stackTop(&opStack, &op);
-                if (op == '(') {
-                    stackPop(&opStack); // Pop left parenthesis
-                    break;
-                }
-                if (!performOperation(&numStack, &opStack)) {
-                    stackDestroy(&numStack);
-                    stackDestroy(&opStack);
-                    return ERROR_VALUE;
-                }
-            }
-            lastWasOp = false;
-            i++;
-            continue;
-        }
-        
-        // Process operator
-        if (isOperator(expr[i])) {
-            char currentOp = expr[i];
-            
-            // Process unary positive/negative sign
-            if ((currentOp == '+' || currentOp == '-') && lastWasOp) {
-                if (currentOp == '-') {
-                    stackPush(&numStack, 0); // Push 0 for subtraction processing
-                }
-                // Unary + sign is not treated specially
-                if (currentOp == '-') {
-                    stackPush(&opStack, (int)currentOp);
-                }
-                lastWasOp = true;
-                i++;
-                continue;
-            }
-            
-            // Process regular operators
-            while (!stackIsEmpty(&opStack)) {
-                stackTop(&opStack, &op);
-                
-                if (op == '(' || getPriority(currentOp) > getPriority((char)op)) {
-                    break;
-                }
-                
-                if (!performOperation(&numStack, &opStack)) {
-                    stackDestroy(&numStack);
-                    stackDestroy(&opStack);
-                    return ERROR_VALUE;
-                }
-            }
-            
-            stackPush(&opStack, (int)currentOp);
-            lastWasOp = true;
-        }
-        
-        i++;
-    }
+void evaluateLongLine(const char* prefix) {
+    CalcReader reader;
+    long long errorPos = 0;
+    int result;
+    CalcStatus status;
     
-    // Process remaining operators
-    while (!stackIsEmpty(&opStack)) {
-        stackTop(&opStack, &op);
-        
-        if (op == '(') {
-            printf("Expression error: Mismatched parentheses\n");
-            stackDestroy(&numStack);
-            stackDestroy(&opStack);
-            return ERROR_VALUE;
-        }
-        
-        if (!performOperation(&numStack, &opStack)) {
-            stackDestroy(&numStack);
-            stackDestroy(&opStack);
-            return ERROR_VALUE;
-        }
+    if (!calcReaderInitFile(&reader, stdin, prefix, strlen(prefix))) {
+        printf("Memory allocation failed!\n");
+        clearInputBuffer();
+        return;
     }
+    status = evaluateStream(&reader, &result, &errorPos);
+    calcReaderDestroy(&reader);
     
-    // Get final result
-    if (stackSize(&numStack) == 1) {
-        stackTop(&numStack, &result);
-        stackDestroy(&numStack);
-        stackDestroy(&opStack);
-        return result;
+    if (status == CALC_OK) {
+        printf("Result: %d\n", result);
     } else {
-        printf("Expression error: Invalid expression format\n");
-        stackDestroy(&numStack);
-        stackDestroy(&opStack);
-        return ERROR_VALUE;
+        printf("%s\n", calcStatusMessage(status));
+        if (status == CALC_ERR_SYNTAX) {
+            printf("At position %lld\n", errorPos + 1);
+        } else {
+            printf("Calculation error, please check your expression\n");
+        }
     }
 }
 
 /**
- * @brief Determine if character is an operator
- * @param ch Character to check
- * @return true if character is an operator, false otherwise
+ * @brief Evaluate through the expression DAG, each distinct subexpression once
+ * @param expr Expression to evaluate
+ * @param result Receives the result
+ * @return CALC_OK or an error status
  */
-bool isOperator(char ch) {
-    return ch == '+' || ch == '-' || ch == '*' || ch == '/';
+CalcStatus evaluateWithAst(const char* expr, int* result) {
+    CalcAst ast;
+    CalcStatus status = compileAst(expr, &ast);
+    
+    if (status == CALC_OK) {
+        status = evaluateAst(&ast, result);
+        freeAst(&ast);
+    }
+    return status;
 }
 
 /**
- * @brief Get operator priority
- * @param op Operator
- * @return Priority value, higher value means higher priority
+ * @brief Signal handler ending server mode
+ * @param sig Signal number
  */
-int getPriority(char op) {
-    switch (op) {
-        case '+':
-        case '-':
-            return 1;
-        case '*':
-        case '/':
-            return 2;
-        default:
-            return 0;
-    }
+void stopServer(int sig) {
+    (void)sig;
+    serverStop = 1;
 }
 
 /**
- * @brief Execute operation
- * @param numStack Number stack
- * @param opStack Operator stack
- * @return true if operation successful, false otherwise
+ * @brief Run the evaluation server until interrupted
+ * @param address "unix:<path>" or "tcp:<port>"
+ * @return Program exit status code
  */
-bool performOperation(LinkedStack* numStack, LinkedStack* opStack) {
-    int num1, num2, result;
-    int op;
+int serve(const char* address) {
+    struct sigaction action;
+    ServerStats stats = {0, 0, 0};
+    int listenFd;
+    bool ok;
     
-    // Check element count in stack
-    if (stackSize(numStack) < 2) {
-        printf("Expression error: Operator missing operands\n");
-        return false;
+    listenFd = calcServerListen(address);
+    if (listenFd < 0) {
+        perror(address);
+        return 1;
     }
     
-    // Pop two operands and one operator
-    stackTop(opStack, &op);
-    stackPop(opStack);
-    
-    stackTop(numStack, &num2);
-    stackPop(numStack);
-    stackTop(numStack, &num1);
-    stackPop(numStack);
+    // No SA_RESTART, so the signal also wakes epoll_pwait
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = stopServer;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
     
-    // Execute operation
-    switch ((char)op) {
-        case '+':
-            result = num1 + num2;
-            break;
-        case '-':
-            result = num1 - num2;
-            break;
-        case '*':
-            result = num1 * num2;
-            break;
-        case '/':
-            if (num2 == 0) {
-                printf("Error: Division by zero\n");
-                return false;
-            }
-            result = num1 / num2;
-            break;
-        default:
-            printf("Error: Unknown operator %c\n", (char)op);
-            return false;
-    }
-    
-    // Push result back to stack
-    stackPush(numStack, result);
-    return true;
-}
-
-/**
- * @brief Clear input buffer
- */
-void clearInputBuffer(void) {
-    int c;
-    while ((c = getchar()) != '\n' && c != EOF);
+    fprintf(stderr, "Serving on %s\n", address);
+    ok = calcServerRun(listenFd, &serverStop, &stats);
+    calcServerClose(listenFd, address);
+    fprintf(stderr, "%ld connections, %ld expressions, %ld errors\n",
+            stats.connections, stats.requests, stats.errors);
+    return ok ? 0 : 1;
 }